@@ -18,19 +18,89 @@ DFRobot_SHT3x::DFRobot_SHT3x(TwoWire *pWire, uint8_t address,uint8_t RST)
   _address = address;
   _RST = RST;
   measurementMode = eOneShot;
+  rawTemperature = 0;
+  rawHumidity = 0;
+  _pStats = NULL;
+  _pDeadband = NULL;
+  _pTrace = NULL;
+  _pMux = NULL;
+  _muxChannel = SHT3X_MUX_NO_CHANNEL;
+  _pTransport = NULL;
+  _verifyCommands = true;
+  _pendingCommands = 0;
+  _expectHeater = -1;
+  _expectReset = false;
+  _autoRestore = false;
+  _notReady = false;
+  _notReadySince = 0;
+  memset(&_snapshot,0,sizeof(_snapshot));
+  _serialNumber = 0;
   pinMode(_RST,OUTPUT);
   digitalWrite(_RST,HIGH);
 }
 
+DFRobot_SHT3x::DFRobot_SHT3x(DFRobot_SHT3x_Mux *pMux,uint8_t channel,uint8_t address,uint8_t RST)
+  :DFRobot_SHT3x(pMux->getWire(),address,RST)
+{
+  _pMux = pMux;
+  _muxChannel = channel;
+}
+
+DFRobot_SHT3x_Mux *DFRobot_SHT3x::getMux()
+{
+  return _pMux;
+}
+
+uint8_t DFRobot_SHT3x::getMuxChannel()
+{
+  return _muxChannel;
+}
+
 int DFRobot_SHT3x::begin() 
 {
   _pWire->begin();
-  if(readSerialNumber() == 0){
+  _serialNumber = readSerialNumber();
+  if(_serialNumber == 0){
     DBG("bus data access error");
     return ERR_DATA_BUS;
    }
+  //Clear the power-up reset flag, so that checkReset() and the warm begin() only see a reset that comes later
+  writeCommand(SHT3X_CMD_CLEAR_STATUS_REG,2);
   return ERR_OK;
 }
+
+int DFRobot_SHT3x::begin(uint32_t serialNumber,const sConfigSnapshot_t &snapshot)
+{
+  uint8_t register1[3];
+  uint16_t data;
+  sStatusRegister_t registerRaw;
+  _pWire->begin();
+  _serialNumber = serialNumber;
+  _snapshot = snapshot;
+  _notReady = false;
+  measurementMode = snapshot.periodicCmd ? ePeriodic : eOneShot;
+  //One status read, without the retries of readStatusRegister, tells both that the chip answers and whether it kept its state.
+  //It is sent without a break into a cycle that may still run: the chip answers it, the datasheet only recommends a break
+  writeCommand(SHT3X_CMD_READ_STATUS_REG,2);
+  readData(register1,3);
+  if(checkCrc(register1) != register1[2]){
+    DBG("bus data access error");
+    return ERR_DATA_BUS;
+  }
+  data = (register1[0]<<8) | register1[1];
+  memcpy(&registerRaw,&data,2);
+  //The cold begin() and startPeriodicMode() cleared the flag before the snapshot was taken, so it is set by a reset only
+  if(registerRaw.systemResetDeteced){
+    DBG("chip was reset while sleeping, restore the configuration");
+    restoreConfig();
+  }
+  return ERR_OK;
+}
+
+uint32_t DFRobot_SHT3x::getSerialNumber()
+{
+  return _serialNumber;
+}
 uint32_t DFRobot_SHT3x::readSerialNumber()
 {
   uint32_t result = 0 ;
@@ -38,7 +108,7 @@ uint32_t DFRobot_SHT3x::readSerialNumber()
   uint8_t serialNumber2[3];
   uint8_t rawData[6];
   writeCommand(SHT3X_CMD_READ_SERIAL_NUMBER,2);
-  delay(1);
+  wait(1);
   readData(rawData,6);
   memcpy(serialNumber1,rawData,3);
   memcpy(serialNumber2,rawData+3,3);
@@ -55,7 +125,13 @@ bool DFRobot_SHT3x::softReset()
 {
   sStatusRegister_t registerRaw;
   writeCommand(SHT3X_CMD_SOFT_RESET,2);
-  delay(1);
+  memset(&_snapshot,0,sizeof(_snapshot));
+  //The chip needs up to 1.5ms to come back after a soft reset, writeCommand adds the other 1ms
+  wait(1);
+  if(!_verifyCommands){
+    deferVerification(0,true);
+    return true;
+  }
   registerRaw = readStatusRegister();
   if(registerRaw.commandStatus == 0)
     return true;
@@ -67,11 +143,12 @@ bool DFRobot_SHT3x::pinReset()
 {
   sStatusRegister_t registerRaw;
   clearStatusRegister();
+  memset(&_snapshot,0,sizeof(_snapshot));
   digitalWrite(_RST,LOW);
-  delay(1);
+  wait(1);
   digitalWrite(_RST,HIGH);
   //After hardware reset, it takes some time to enter the idle state
-  delay(1);
+  wait(1);
   registerRaw = readStatusRegister();
   if(registerRaw.systemResetDeteced == 1)
     return true;
@@ -84,7 +161,12 @@ bool DFRobot_SHT3x::stopPeriodicMode()
   sStatusRegister_t registerRaw;
   measurementMode = eOneShot;
   writeCommand(SHT3X_CMD_STOP_PERIODIC_ACQUISITION_MODE,2);
-  delay(1);
+  _snapshot.periodicCmd = 0;
+  if(!_verifyCommands){
+    deferVerification(-1,false);
+    return true;
+  }
+  wait(1);
   registerRaw = readStatusRegister();
   if(registerRaw.commandStatus == 0)
     return true;
@@ -92,11 +174,19 @@ bool DFRobot_SHT3x::stopPeriodicMode()
     return false;
 }
 
-bool DFRobot_SHT3x::heaterEnable()
+bool DFRobot_SHT3x::heaterEnable(bool verify)
 {
   sStatusRegister_t registerRaw;
   writeCommand(SHT3X_CMD_HEATER_ENABLE,2);
-  delay(1);
+  _snapshot.heater = 1;
+  if(!_verifyCommands){
+    deferVerification(1,false);
+    return true;
+  }
+  if(!verify){
+    return true;
+  }
+  wait(1);
   registerRaw = readStatusRegister();
   if(registerRaw.heaterStaus == 1)
     return true;
@@ -104,11 +194,19 @@ bool DFRobot_SHT3x::heaterEnable()
     return false;
 }
 
-bool DFRobot_SHT3x::heaterDisable()
+bool DFRobot_SHT3x::heaterDisable(bool verify)
 {
   sStatusRegister_t registerRaw;
   writeCommand( SHT3X_CMD_HEATER_DISABLE,2);
-  delay(1);
+  _snapshot.heater = 0;
+  if(!_verifyCommands){
+    deferVerification(0,false);
+    return true;
+  }
+  if(!verify){
+    return true;
+  }
+  wait(1);
   registerRaw = readStatusRegister();
   if(registerRaw.heaterStaus == 0)
     return true;
@@ -116,15 +214,164 @@ bool DFRobot_SHT3x::heaterDisable()
     return false;
 }
 
+void DFRobot_SHT3x::setCommandVerification(bool enable)
+{
+  _verifyCommands = enable;
+}
+
+void DFRobot_SHT3x::deferVerification(int8_t heater,bool reset)
+{
+  if(_pendingCommands < 0xFF){
+    _pendingCommands++;
+  }
+  if(heater >= 0){
+    _expectHeater = heater;
+  }
+  if(reset){
+    _expectReset = true;
+  }
+}
+
+bool DFRobot_SHT3x::verifyCommands()
+{
+  sStatusRegister_t registerRaw;
+  bool result = true;
+  if(_pendingCommands == 0){
+    return true;
+  }
+  wait(1);
+  registerRaw = readStatusRegister();
+  if(registerRaw.commandStatus == 1 || registerRaw.writeDataChecksumStatus == 1){
+    result = false;
+  }
+  if(_expectHeater >= 0 && registerRaw.heaterStaus != _expectHeater){
+    result = false;
+  }
+  if(_expectReset && registerRaw.systemResetDeteced == 0){
+    result = false;
+  }
+  if(_expectReset && result){
+    //The flag has proved the soft reset, clear it so that checkReset() does not take it for a new reset
+    writeCommand(SHT3X_CMD_CLEAR_STATUS_REG,2);
+  }
+  DBG(result);
+  _pendingCommands = 0;
+  _expectHeater = -1;
+  _expectReset = false;
+  return result;
+}
+
+uint8_t DFRobot_SHT3x::getPendingCommands()
+{
+  return _pendingCommands;
+}
+
+void DFRobot_SHT3x::setAutoRestore(bool enable)
+{
+  _autoRestore = enable;
+}
+
+bool DFRobot_SHT3x::getAutoRestore()
+{
+  return _autoRestore;
+}
+
+void DFRobot_SHT3x::startStatusRead()
+{
+  writeCommand(SHT3X_CMD_READ_STATUS_REG,2);
+}
+
+int DFRobot_SHT3x::readStatusResult(sStatusRegister_t &status)
+{
+  uint8_t register1[3];
+  uint16_t data;
+  if(readData(register1,3) != 3){
+    return ERR_NOT_READY;
+  }
+  if(checkCrc(register1) != register1[2]){
+    return -1;
+  }
+  data = (register1[0]<<8) | register1[1];
+  memcpy(&status,&data,2);
+  return 0;
+}
+
+bool DFRobot_SHT3x::checkReset()
+{
+  sStatusRegister_t registerRaw;
+  uint8_t retry = 10;
+  int ret = -1;
+  if(_pMux){
+    //The glitch that reset the chip may have reset the multiplexer too, select the channel again
+    _pMux->invalidate();
+  }
+  //Unlike readStatusRegister() an unanswered read is not taken for a set reset flag
+  while(retry-- && ret != 0){
+    startStatusRead();
+    wait(1);
+    ret = readStatusResult(registerRaw);
+  }
+  if(ret != 0 || registerRaw.systemResetDeteced == 0){
+    return false;
+  }
+  DBG("reset detected, restore the configuration");
+  restoreConfig();
+  return true;
+}
+
+uint16_t DFRobot_SHT3x::getPeriodMs()
+{
+  switch(_snapshot.periodicCmd >> 8){
+    case 0x21: return 1000;
+    case 0x22: return 500;
+    case 0x23: return 250;
+    case 0x27: return 100;
+    default: return 2000;
+  }
+}
+
+void DFRobot_SHT3x::restoreConfig()
+{
+  const uint16_t cmd[4] = {SHT3X_CMD_WRITE_HIGH_ALERT_LIMIT_SET,SHT3X_CMD_WRITE_HIGH_ALERT_LIMIT_CLEAR,
+                           SHT3X_CMD_WRITE_LOW_ALERT_LIMIT_CLEAR,SHT3X_CMD_WRITE_LOW_ALERT_LIMIT_SET};
+  //The chip answers status and configuration commands during the cycle (the datasheet only recommends a break
+  //before them), as the alert and status reads of this driver always relied on, so no break is sent here
+  //Clearing the status first re-arms systemResetDeteced for the next reset
+  writeCommand(SHT3X_CMD_CLEAR_STATUS_REG,2);
+  for(uint8_t i = 0; i < 4; i++){
+    if(_snapshot.limitMask & (1 << i)){
+      wait(1);
+      writeLimitData(cmd[i],_snapshot.limit[i]);
+    }
+  }
+  _notReady = false;
+  if(_snapshot.heater){
+    writeCommand(SHT3X_CMD_HEATER_ENABLE,2);
+  }
+  if(_snapshot.periodicCmd){
+    writeCommand(_snapshot.periodicCmd,2);
+  }
+}
+
+const DFRobot_SHT3x::sConfigSnapshot_t &DFRobot_SHT3x::getConfigSnapshot()
+{
+  return _snapshot;
+}
+
+void DFRobot_SHT3x::setConfigSnapshot(const sConfigSnapshot_t &snapshot)
+{
+  _snapshot = snapshot;
+}
+
 void DFRobot_SHT3x::clearStatusRegister(){
   writeCommand(SHT3X_CMD_CLEAR_STATUS_REG,2);
-  delay(10);
+  wait(10);
 }
 
 bool DFRobot_SHT3x::readAlertState()
 {
   sStatusRegister_t registerRaw;
-  delay(1);
+  wait(1);
   registerRaw = readStatusRegister();
   if(registerRaw.humidityAlert == 1 || registerRaw.temperatureAlert == 1){
     return true;
@@ -134,57 +381,174 @@ bool DFRobot_SHT3x::readAlertState()
 }
 DFRobot_SHT3x::sRHAndTemp_t DFRobot_SHT3x::readTemperatureAndHumidity(eRepeatability_t repeatability)
 {
-  uint8_t rawData[6];
-  uint8_t rawTemperature[3];
-  uint8_t rawHumidity[3];
-  tempRH.ERR = 0;
-      switch(repeatability){
-        case eRepeatability_High:writeCommand(SHT3X_CMD_GETDATA_POLLING_H,2);break;
-        case eRepeatability_Medium:writeCommand(SHT3X_CMD_GETDATA_POLLING_M,2);break;
-        case eRepeatability_Low:writeCommand(SHT3X_CMD_GETDATA_POLLING_L,2);break;
+  const uint16_t cmd[3] = {SHT3X_CMD_GETDATA_POLLING_H,SHT3X_CMD_GETDATA_POLLING_M,SHT3X_CMD_GETDATA_POLLING_L};
+  const uint8_t waitMs[3] = {SHT3X_CONVERSION_TIME_H_MS,SHT3X_CONVERSION_TIME_M_MS,SHT3X_CONVERSION_TIME_L_MS};
+  tempRH.ERR = readRawData(cmd[repeatability],waitMs[repeatability]);
+  if(tempRH.ERR == 0){
+    convertRawData();
+  }
+  return tempRH;
+}
+
+void DFRobot_SHT3x::startMeasurement(eRepeatability_t repeatability)
+{
+  const uint16_t cmd[3] = {SHT3X_CMD_GETDATA_POLLING_H,SHT3X_CMD_GETDATA_POLLING_M,SHT3X_CMD_GETDATA_POLLING_L};
+  writeCommand(cmd[repeatability],2);
+}
+
+int DFRobot_SHT3x::readMeasurement(sRHAndTemp_t &data)
+{
+  tempRH.ERR = readRawResult();
+  if(tempRH.ERR == 0){
+    convertRawData();
+  }
+  data = tempRH;
+  return tempRH.ERR;
+}
+
+DFRobot_SHT3x::sOversampledRHAndTemp_t DFRobot_SHT3x::readTemperatureAndHumidity(eRepeatability_t repeatability,uint8_t samples)
+{
+  const uint16_t cmd[3] = {SHT3X_CMD_GETDATA_POLLING_H,SHT3X_CMD_GETDATA_POLLING_M,SHT3X_CMD_GETDATA_POLLING_L};
+  const uint8_t waitMs[3] = {SHT3X_CONVERSION_TIME_H_MS,SHT3X_CONVERSION_TIME_M_MS,SHT3X_CONVERSION_TIME_L_MS};
+  sOversampledRHAndTemp_t data;
+  DFRobot_SHT3x_Stats stats;
+  DFRobot_SHT3x_Stats *pAttached = _pStats;
+  memset(&data,0,sizeof(data));
+  //The conversions are accumulated locally, the attached accumulator only gets the average
+  _pStats = NULL;
+  for(uint8_t i = 0; i < samples; i++){
+    if(readRawData(cmd[repeatability],waitMs[repeatability]) == 0){
+      stats.addSample(rawTemperature,rawHumidity);
     }
-  delay(15);
-  readData(rawData,6);
-  memcpy(rawTemperature,rawData,3);
-  memcpy(rawHumidity,rawData+3,3);
-  if((checkCrc(rawTemperature) != rawTemperature[2]) || (checkCrc(rawHumidity) != rawHumidity[2])){
+  }
+  _pStats = pAttached;
+  data.samples = stats.getCount();
+  if(data.samples == 0){
+    data.ERR = -1;
     tempRH.ERR = -1;
-    return tempRH;
+    return data;
+  }
+  rawTemperature = (stats.getRawStats(DFRobot_SHT3x_Stats::eTemperature).mean + (1 << (SHT3X_STATS_FRAC_BITS - 1))) >> SHT3X_STATS_FRAC_BITS;
+  rawHumidity = (stats.getRawStats(DFRobot_SHT3x_Stats::eHumidity).mean + (1 << (SHT3X_STATS_FRAC_BITS - 1))) >> SHT3X_STATS_FRAC_BITS;
+  if(_pStats){
+    _pStats->addSample(rawTemperature,rawHumidity);
+  }
+  data.TemperatureC = stats.getMean(DFRobot_SHT3x_Stats::eTemperature);
+  data.Humidity = stats.getMean(DFRobot_SHT3x_Stats::eHumidity);
+#ifndef SHT3X_DISABLE_FAHRENHEIT
+  data.TemperatureF = 1.8f * data.TemperatureC + 32.0f;
+  tempRH.TemperatureF = data.TemperatureF;
+#endif
+  data.TemperatureNoiseC = sqrt(stats.getVariance(DFRobot_SHT3x_Stats::eTemperature) / data.samples);
+  data.HumidityNoise = sqrt(stats.getVariance(DFRobot_SHT3x_Stats::eHumidity) / data.samples);
+  tempRH.TemperatureC = data.TemperatureC;
+  tempRH.Humidity = data.Humidity;
+  tempRH.ERR = 0;
+  return data;
+}
+
+int DFRobot_SHT3x::readRawData(uint16_t cmd,uint8_t waitMs)
+{
+  writeCommand(cmd,2);
+  int ret;
+  if(waitMs){
+    wait(waitMs);
+  }
+  ret = readRawResult();
+  if(ret == ERR_NOT_READY && waitMs && _autoRestore){
+    //A NACK after the whole conversion time of a single measurement, the chip may have been reset
+    checkReset();
+  }
+  return ret;
+}
+
+int DFRobot_SHT3x::readRawResult()
+{
+  uint8_t rawData[6];
+  if(readData(rawData,6) != 6){
+    //A NACK is the normal answer to an early fetch in cycle measurement mode (and means nothing about a reset in
+    //single measurement mode), only no sample for two measurement periods hints that the chip was reset
+    if(_autoRestore && measurementMode == ePeriodic){
+      uint32_t now = millis();
+      if(!_notReady){
+        _notReady = true;
+        _notReadySince = now;
+      } else if(now - _notReadySince > 2 * (uint32_t)getPeriodMs()){
+        _notReady = false;
+        checkReset();
+      }
+    }
+    return ERR_NOT_READY;
   }
+  _notReady = false;
+  if((checkCrc(rawData) != rawData[2]) || (checkCrc(rawData+3) != rawData[5])){
+    if(_autoRestore){
+      checkReset();
+    }
+    return -1;
+  }
+  rawTemperature = ((uint16_t)rawData[0] << 8) | rawData[1];
+  rawHumidity = ((uint16_t)rawData[3] << 8) | rawData[4];
+  if(_pStats){
+    _pStats->addSample(rawTemperature,rawHumidity);
+  }
+  return 0;
+}
+
+int DFRobot_SHT3x::readRawData()
+{
+  if(measurementMode == eOneShot){
+    return readRawData(SHT3X_CMD_GETDATA_POLLING_H,SHT3X_CONVERSION_TIME_H_MS);
+  }
+  return readRawData(SHT3X_CMD_GETDATA,0);
+}
+
+void DFRobot_SHT3x::convertRawData()
+{
   tempRH.TemperatureC = convertTemperature(rawTemperature);
-  tempRH.TemperatureF = 1.8*tempRH.TemperatureC+32;
   tempRH.Humidity = convertHumidity(rawHumidity);
-  return tempRH;
+#ifndef SHT3X_DISABLE_FAHRENHEIT
+  tempRH.TemperatureF = 1.8f * tempRH.TemperatureC + 32.0f;
+#endif
 }
 
 float DFRobot_SHT3x::getTemperatureC(){
-  if(measurementMode == eOneShot){
-    readTemperatureAndHumidity(eRepeatability_High);
-  } else {
-    readTemperatureAndHumidity();
+  tempRH.ERR = readRawData();
+  if(tempRH.ERR == 0){
+    tempRH.TemperatureC = convertTemperature(rawTemperature);
   }
   return tempRH.TemperatureC;
 }
 
+#ifndef SHT3X_DISABLE_FAHRENHEIT
 float DFRobot_SHT3x::getTemperatureF()
 {
-  if(measurementMode == eOneShot){
-    readTemperatureAndHumidity(eRepeatability_High);
-  } else {
-    readTemperatureAndHumidity();
+  tempRH.ERR = readRawData();
+  if(tempRH.ERR == 0){
+    tempRH.TemperatureF = 1.8f * convertTemperature(rawTemperature) + 32.0f;
   }
   return tempRH.TemperatureF;
 }
+#endif
 
 float DFRobot_SHT3x::getHumidityRH()
 {
-  if(measurementMode == eOneShot){
-    readTemperatureAndHumidity(eRepeatability_High);
-  } else {
-    readTemperatureAndHumidity();
+  tempRH.ERR = readRawData();
+  if(tempRH.ERR == 0){
+    tempRH.Humidity = convertHumidity(rawHumidity);
   }
   return tempRH.Humidity;
 }
+uint16_t DFRobot_SHT3x::getRawTemperature()
+{
+  return rawTemperature;
+}
+
+uint16_t DFRobot_SHT3x::getRawHumidity()
+{
+  return rawHumidity;
+}
+
 bool DFRobot_SHT3x::startPeriodicMode(eMeasureFrequency_t measureFreq,eRepeatability_t repeatability)
 {
   const uint16_t cmd[5][3] ={{SHT3X_CMD_SETMODE_H_FREQUENCY_HALF_HZ,SHT3X_CMD_SETMODE_M_FREQUENCY_HALF_HZ,SHT3X_CMD_SETMODE_L_FREQUENCY_HALF_HZ}\
@@ -193,9 +557,19 @@ bool DFRobot_SHT3x::startPeriodicMode(eMeasureFrequency_t measureFreq,eRepeatabi
   ,{SHT3X_CMD_SETMODE_H_FREQUENCY_4_HZ,SHT3X_CMD_SETMODE_M_FREQUENCY_4_HZ,SHT3X_CMD_SETMODE_L_FREQUENCY_4_HZ}\
   ,{SHT3X_CMD_SETMODE_H_FREQUENCY_10_HZ,SHT3X_CMD_SETMODE_M_FREQUENCY_10_HZ,SHT3X_CMD_SETMODE_L_FREQUENCY_10_HZ}} ;
   sStatusRegister_t registerRaw;
+  if(!_expectReset){
+    //Clear the reset flag, a deferred softReset keeps it for verifyCommands()
+    writeCommand(SHT3X_CMD_CLEAR_STATUS_REG,2);
+  }
   measurementMode = ePeriodic;
+  _notReady = false;
   writeCommand(cmd[measureFreq][repeatability],2);
-  delay(1);
+  _snapshot.periodicCmd = cmd[measureFreq][repeatability];
+  if(!_verifyCommands){
+    deferVerification(-1,false);
+    return true;
+  }
+  wait(1);
   registerRaw = readStatusRegister();
   if(registerRaw.commandStatus == 0)
     return true;
@@ -210,7 +584,7 @@ DFRobot_SHT3x::sStatusRegister_t DFRobot_SHT3x::readStatusRegister(){
   uint8_t retry = 10;
   while(retry--){
     writeCommand(SHT3X_CMD_READ_STATUS_REG,2);
-    delay(1);
+    wait(1);
     readData(register1,3);
     if(checkCrc(register1) == register1[2]){
       break;
@@ -225,7 +599,7 @@ uint8_t DFRobot_SHT3x::environmentState()
   sStatusRegister_t registerRaw;
   float rhHighSet ;
   float rhLowSet ;
-  delay(1);
+  wait(1);
   registerRaw = readStatusRegister();
   sRHAndTemp_t data = readTemperatureAndHumidity();
   if(measureTemperatureLimitC()){
@@ -264,21 +638,10 @@ uint8_t DFRobot_SHT3x::environmentState()
 }
 DFRobot_SHT3x::sRHAndTemp_t DFRobot_SHT3x::readTemperatureAndHumidity()
 {
-  uint8_t rawData[6];
-  uint8_t rawTemperature[3];
-  uint8_t rawHumidity[3];
-  tempRH.ERR = 0;
-  writeCommand(SHT3X_CMD_GETDATA,2);
-  readData(rawData,6);
-  memcpy(rawTemperature,rawData,3);
-  memcpy(rawHumidity,rawData+3,3);
-  if((checkCrc(rawTemperature) != rawTemperature[2]) || (checkCrc(rawHumidity) != rawHumidity[2])){
-    tempRH.ERR = -1; 
-    return tempRH;
+  tempRH.ERR = readRawData(SHT3X_CMD_GETDATA,0);
+  if(tempRH.ERR == 0){
+    convertRawData();
   }
-  tempRH.TemperatureC = convertTemperature(rawTemperature);
-  tempRH.Humidity = convertHumidity(rawHumidity);
-  tempRH.TemperatureF = 1.8*tempRH.TemperatureC+32;
   return tempRH;
 }
 
@@ -317,18 +680,20 @@ uint8_t  DFRobot_SHT3x::setTemperatureLimitC(float highset,float highclear, floa
    
   return 0;
 }
+#ifndef SHT3X_DISABLE_FAHRENHEIT
 uint8_t DFRobot_SHT3x::setTemperatureLimitF(float highset,float highclear,float lowset,float lowclear)
 {
   float _highset ,_highclear,_lowclear,_lowset;
-  _highset = (highset - 32.0) * 5.0 / 9.0;
-  _highclear = (highclear - 32.0) * 5.0 / 9.0;
-  _lowclear = (lowclear - 32.0) * 5.0 / 9.0;
-  _lowset = (lowset - 32.0) * 5.0 / 9.0;
+  _highset = (highset - 32.0f) * 5.0f / 9.0f;
+  _highclear = (highclear - 32.0f) * 5.0f / 9.0f;
+  _lowclear = (lowclear - 32.0f) * 5.0f / 9.0f;
+  _lowset = (lowset - 32.0f) * 5.0f / 9.0f;
   if(setTemperatureLimitC(_highset,_highclear,_lowset,_lowclear) == 0){
     return 0;
   }
   return 1;
 }
+#endif
 uint8_t DFRobot_SHT3x::setHumidityLimitRH(float highset,float highclear, float lowset,float lowclear)
 {
   uint16_t _highset ,_highclear,_lowclear,_lowset,limit[1];
@@ -364,60 +729,41 @@ uint8_t DFRobot_SHT3x::setHumidityLimitRH(float highset,float highclear, float l
   return 0;
 }
 
-bool DFRobot_SHT3x::measureTemperatureLimitC(){
+bool DFRobot_SHT3x::measureTemperatureLimitC()
+{
+  return measureTemperatureLimit(false);
+}
 
-  uint16_t limit[1] ;
+bool DFRobot_SHT3x::measureTemperatureLimit(bool fahrenheit)
+{
+  const uint16_t cmd[4] = {SHT3X_CMD_READ_HIGH_ALERT_LIMIT_SET,SHT3X_CMD_READ_HIGH_ALERT_LIMIT_CLEAR,
+                           SHT3X_CMD_READ_LOW_ALERT_LIMIT_CLEAR,SHT3X_CMD_READ_LOW_ALERT_LIMIT_SET};
+  float *pLimit[4] = {&limitData.highSet,&limitData.highClear,&limitData.lowClear,&limitData.lowSet};
+  uint16_t limit[1];
   float data;
-  if(readLimitData(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_SET,limit) != 0) {
-    return false;
-  }
-  data = convertTempLimitData(limit);
-  limitData.highSet = round(data);
-  if(readLimitData(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_CLEAR,limit) != 0){
-    return false;
-  }
-  data = convertTempLimitData(limit);
-  limitData.highClear = round(data);
-  if(readLimitData(SHT3X_CMD_READ_LOW_ALERT_LIMIT_CLEAR,limit) != 0){
-    return false;
-  }
-  data = convertTempLimitData(limit);
-  limitData.lowClear = round(data);
-  if(readLimitData(SHT3X_CMD_READ_LOW_ALERT_LIMIT_SET,limit) != 0){
-    return false;
+  for(uint8_t i = 0; i < 4; i++){
+    if(readLimitData(cmd[i],limit) != 0){
+      return false;
+    }
+    data = convertTempLimitData(limit);
+#ifndef SHT3X_DISABLE_FAHRENHEIT
+    if(fahrenheit){
+      data = data * 1.8f + 32.0f;
+    }
+#else
+    (void)fahrenheit;
+#endif
+    *pLimit[i] = round(data);
   }
-  data = convertTempLimitData(limit);
-  limitData.lowSet = round(data);
   return true;
 }
 
+#ifndef SHT3X_DISABLE_FAHRENHEIT
 bool DFRobot_SHT3x::measureTemperatureLimitF()
 {
-  uint16_t limit[1] ;
-  float data;
-  if(readLimitData(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_SET,limit) != 0) {
-    return false;
-  }
-  data = convertTempLimitData(limit);
-  limitData.highSet = round(data * 9.0 / 5.0 + 32.0);
-  if(readLimitData(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_CLEAR,limit) != 0){
-    return false;
-  }
-  data = convertTempLimitData(limit);
-  limitData.highClear = round(data * 9.0 / 5.0 + 32.0);
-  if(readLimitData(SHT3X_CMD_READ_LOW_ALERT_LIMIT_CLEAR,limit) != 0){
-    return false;
-  }
-  data = convertTempLimitData(limit);
-  limitData.lowClear = round(data * 9.0 / 5.0 + 32.0);
-  if(readLimitData(SHT3X_CMD_READ_LOW_ALERT_LIMIT_SET,limit) != 0){
-    return false;
-  }
-  data = convertTempLimitData(limit);
-  limitData.lowSet = round(data * 9.0 / 5.0 + 32.0);
-  return true;
-
+  return measureTemperatureLimit(true);
 }
+
 float DFRobot_SHT3x::getTemperatureHighSetF(){
   return limitData.highSet;
 }
@@ -432,6 +778,44 @@ float DFRobot_SHT3x::getTemperatureLowClearF(){
 float DFRobot_SHT3x::getTemperatureLowSetF(){
   return limitData.lowSet;
 }
+#endif
+void DFRobot_SHT3x::attachStatistics(DFRobot_SHT3x_Stats *pStats)
+{
+  _pStats = pStats;
+}
+
+void DFRobot_SHT3x::attachDeadband(DFRobot_SHT3x_Deadband *pDeadband)
+{
+  _pDeadband = pDeadband;
+}
+
+void DFRobot_SHT3x::attachTrace(DFRobot_SHT3x_Trace *pTrace)
+{
+  _pTrace = pTrace;
+}
+
+void DFRobot_SHT3x::setTransport(DFRobot_SHT3x_Transport *pTransport)
+{
+  _pTransport = pTransport;
+}
+
+bool DFRobot_SHT3x::readTemperatureAndHumidityOnChange(sRHAndTemp_t &data)
+{
+  tempRH.ERR = readRawData();
+  if(tempRH.ERR != 0){
+    data.ERR = tempRH.ERR;
+    return false;
+  }
+  if(_pDeadband && !_pDeadband->check(rawTemperature,rawHumidity,millis())){
+    //read fine but not reported, the other fields keep the last reported sample
+    data.ERR = 0;
+    return false;
+  }
+  convertRawData();
+  data = tempRH;
+  return true;
+}
+
 uint8_t DFRobot_SHT3x::readLimitData(uint16_t cmd,uint16_t *pBuf)
 { 
   uint8_t rawData[3];
@@ -443,8 +827,8 @@ uint8_t DFRobot_SHT3x::readLimitData(uint16_t cmd,uint16_t *pBuf)
   if(checkCrc(rawData) != crc){
     return 1 ;
   }
-  pBuf[1] = rawData[0];
-  pBuf[1] = (pBuf[1] << 8) | rawData[1];
+  pBuf[0] = rawData[0];
+  pBuf[0] = (pBuf[0] << 8) | rawData[1];
   return 0;
 }
 float DFRobot_SHT3x::getTemperatureHighSetC(){
@@ -500,6 +884,10 @@ float DFRobot_SHT3x::convertTemperature(uint8_t rawTemperature[])
   uint16_t rawValue ;
   rawValue = rawTemperature[0];
   rawValue = (rawValue << 8) | rawTemperature[1];
+  return convertTemperature(rawValue);
+}
+float DFRobot_SHT3x::convertTemperature(uint16_t rawValue)
+{
   return 175.0f * (float)rawValue / 65535.0f - 45.0f;
 }
 float DFRobot_SHT3x::convertHumidity(uint8_t rawHumidity[])
@@ -507,6 +895,10 @@ float DFRobot_SHT3x::convertHumidity(uint8_t rawHumidity[])
   uint16_t rawValue ;
   rawValue = rawHumidity[0];
   rawValue = (rawValue << 8) | rawHumidity[1];
+  return convertHumidity(rawValue);
+}
+float DFRobot_SHT3x::convertHumidity(uint16_t rawValue)
+{
   return 100.0f * (float)rawValue / 65535.0f;
 }
 
@@ -522,17 +914,17 @@ uint16_t DFRobot_SHT3x::convertRawHumidity(float value)
 
 float DFRobot_SHT3x::convertTempLimitData(uint16_t limit[])
 {
-  limit[1] = limit[1] << 7;
-  limit[1] = limit[1] & 0xFF80;
-  limit[1] = limit[1] | 0x1A;
-  return 175.0f * (float)limit[1] / 65535.0f - 45.0f;
+  limit[0] = limit[0] << 7;
+  limit[0] = limit[0] & 0xFF80;
+  limit[0] = limit[0] | 0x1A;
+  return 175.0f * (float)limit[0] / 65535.0f - 45.0f;
 }
 
 float DFRobot_SHT3x::convertHumidityLimitData(uint16_t limit[])
 {
-  limit[1] = limit[1] & 0xFE00;
-  limit[1] = limit[1] | 0xCD;
-  return round(100.0f * (float)limit[1] / 65535.0f) ;
+  limit[0] = limit[0] & 0xFE00;
+  limit[0] = limit[0] | 0xCD;
+  return round(100.0f * (float)limit[0] / 65535.0f) ;
 }
 
 uint8_t DFRobot_SHT3x::checkCrc(uint8_t data[])
@@ -555,6 +947,14 @@ uint8_t DFRobot_SHT3x::checkCrc(uint8_t data[])
 }
 
 void DFRobot_SHT3x::writeLimitData(uint16_t cmd,uint16_t limitData){
+  const uint16_t limitCmd[4] = {SHT3X_CMD_WRITE_HIGH_ALERT_LIMIT_SET,SHT3X_CMD_WRITE_HIGH_ALERT_LIMIT_CLEAR,
+                                SHT3X_CMD_WRITE_LOW_ALERT_LIMIT_CLEAR,SHT3X_CMD_WRITE_LOW_ALERT_LIMIT_SET};
+  for(uint8_t i = 0; i < 4; i++){
+    if(limitCmd[i] == cmd){
+      _snapshot.limit[i] = limitData;
+      _snapshot.limitMask |= 1 << i;
+    }
+  }
   uint8_t _pBuf[5];
   _pBuf[0] = cmd >>8;
   _pBuf[1] = cmd & 0xff;
@@ -570,21 +970,54 @@ void DFRobot_SHT3x::writeCommand(uint16_t cmd,size_t size)
   uint8_t _pBuf[2];
   _pBuf[0] = cmd >> 8;
   _pBuf[1] = cmd & 0xFF;
-  delay(1);
+  if(_pTrace){
+    _pTrace->record(DFRobot_SHT3x_Trace::eTraceCommand,DFRobot_SHT3x_Trace::eTraceBegin,cmd);
+  }
+  wait(1);
   write(_pBuf,2);
+  if(_pTrace){
+    _pTrace->record(DFRobot_SHT3x_Trace::eTraceCommand,DFRobot_SHT3x_Trace::eTraceEnd,cmd);
+  }
 }
 
-void DFRobot_SHT3x::write(const void* pBuf,size_t size)
+uint8_t DFRobot_SHT3x::write(const void* pBuf,size_t size)
 {
   if (pBuf == NULL) {
     DBG("pBuf ERROR!! : null pointer");
   }
   uint8_t * _pBuf = (uint8_t *)pBuf;
-  _pWire->beginTransmission(_address);
-  for (uint8_t i = 0; i < size; i++) {
-    _pWire->write(_pBuf[i]);
+  uint16_t cmd = size >= 2 ? (_pBuf[0] << 8) | _pBuf[1] : 0;
+  if(_pTrace){
+    _pTrace->record(DFRobot_SHT3x_Trace::eTraceWrite,DFRobot_SHT3x_Trace::eTraceBegin,cmd);
+  }
+  uint8_t status;
+  if(_pMux && !_pMux->select(_muxChannel)){
+    //the chip is not reachable, the command is dropped as if it answered NACK
+    status = 2;
+  } else if(_pTransport){
+    status = _pTransport->write(_address,_pBuf,size);
+  } else {
+    _pWire->beginTransmission(_address);
+    for (uint8_t i = 0; i < size; i++) {
+      _pWire->write(_pBuf[i]);
+    }
+    status = _pWire->endTransmission();
+  }
+  if(_pTrace){
+    _pTrace->record(DFRobot_SHT3x_Trace::eTraceWrite,DFRobot_SHT3x_Trace::eTraceEnd,cmd);
+  }
+  return status;
+}
+
+void DFRobot_SHT3x::wait(uint16_t ms)
+{
+  if(_pTrace){
+    _pTrace->record(DFRobot_SHT3x_Trace::eTraceDelay,DFRobot_SHT3x_Trace::eTraceBegin,ms);
+  }
+  delay(ms);
+  if(_pTrace){
+    _pTrace->record(DFRobot_SHT3x_Trace::eTraceDelay,DFRobot_SHT3x_Trace::eTraceEnd,ms);
   }
-  _pWire->endTransmission();
 }
 
 uint8_t DFRobot_SHT3x::readData(void *pBuf, size_t size) {
@@ -593,11 +1026,25 @@ uint8_t DFRobot_SHT3x::readData(void *pBuf, size_t size) {
   }
   uint8_t * _pBuf = (uint8_t *)pBuf;
 
-  _pWire->requestFrom(_address,size);
-  uint8_t len = 0;
-  for (uint8_t i = 0 ; i < size; i++) {
-    _pBuf[i] = _pWire->read();
-    len++;
+  if(_pTrace){
+    _pTrace->record(DFRobot_SHT3x_Trace::eTraceRead,DFRobot_SHT3x_Trace::eTraceBegin,size);
+  }
+  uint8_t len;
+  if(_pMux && !_pMux->select(_muxChannel)){
+    //same bytes as a read the chip answered NACK, so no stale data passes the CRC check
+    memset(_pBuf,0xFF,size);
+    len = 0;
+  } else if(_pTransport){
+    len = _pTransport->read(_address,_pBuf,size);
+  } else {
+    //requestFrom returns 0 when the chip answers NACK
+    len = _pWire->requestFrom(_address,size);
+    for (uint8_t i = 0 ; i < size; i++) {
+      _pBuf[i] = _pWire->read();
+    }
+  }
+  if(_pTrace){
+    _pTrace->record(DFRobot_SHT3x_Trace::eTraceRead,DFRobot_SHT3x_Trace::eTraceEnd,len);
   }
 
   return len;
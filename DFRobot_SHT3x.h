@@ -15,6 +15,11 @@
 #define DFROBOT_SHT3X_H
 #include "Arduino.h"
 #include <Wire.h>
+#include "DFRobot_SHT3x_Stats.h"
+#include "DFRobot_SHT3x_Deadband.h"
+#include "DFRobot_SHT3x_Trace.h"
+#include "DFRobot_SHT3x_Mux.h"
+#include "DFRobot_SHT3x_Transport.h"
 
 //#define ENABLE_DBG
 #ifdef ENABLE_DBG
@@ -23,6 +28,12 @@
 #define DBG(...)
 #endif
 
+/**
+ * Uncomment to build a Celsius-only driver: the Fahrenheit conversion is never computed,
+ * sRHAndTemp_t loses its TemperatureF member and all the *F methods are left out of the build.
+ */
+//#define SHT3X_DISABLE_FAHRENHEIT
+
 #define SHT3X_CMD_GETDATA_POLLING_H (0x2400) // measurement: polling, high repeatability
 #define SHT3X_CMD_GETDATA_POLLING_M (0x240B) // measurement: polling, medium repeatability
 #define SHT3X_CMD_GETDATA_POLLING_L (0x2416) // measurement: polling, low repeatability
@@ -63,12 +74,17 @@
 #define SHT3X_CMD_WRITE_HIGH_ALERT_LIMIT_CLEAR   (0x6116)///<  Write alert limits, high clear
 #define SHT3X_CMD_WRITE_LOW_ALERT_LIMIT_CLEAR    (0x610B)///<  Write alert limits, low clear
 #define SHT3X_CMD_WRITE_LOW_ALERT_LIMIT_SET      (0x6100)///<  Write alert limits, low set
+
+#define SHT3X_CONVERSION_TIME_H_MS               16///<  Max single measurement time, high repeatability (15.5ms)
+#define SHT3X_CONVERSION_TIME_M_MS               7 ///<  Max single measurement time, medium repeatability (6.5ms)
+#define SHT3X_CONVERSION_TIME_L_MS               5 ///<  Max single measurement time, low repeatability (4.5ms)
 class DFRobot_SHT3x
 {
 public:
   #define ERR_OK             0      //No error
   #define ERR_DATA_BUS      -1      //Data bus error
   #define ERR_IC_VERSION    -2      //Chip version does not match
+  #define ERR_NOT_READY     -3      //The chip answered NACK, e.g. no new data yet in cycle measurement mode
   
   /**
    * @struct sStatusRegister_t
@@ -150,9 +166,27 @@ public:
   typedef struct{
     float TemperatureC;
     float Humidity;
+#ifndef SHT3X_DISABLE_FAHRENHEIT
     float TemperatureF;
+#endif
     int ERR;
   }sRHAndTemp_t;
+
+  /**
+   * @struct sOversampledRHAndTemp_t
+   * @brief Structures used to store the average of several single measurements and its noise estimate
+   */
+  typedef struct{
+    float TemperatureC;
+    float Humidity;
+#ifndef SHT3X_DISABLE_FAHRENHEIT
+    float TemperatureF;
+#endif
+    float TemperatureNoiseC;/**<Standard deviation of the averaged temperature (°C), sample deviation / sqrt(samples)*/
+    float HumidityNoise;/**<Standard deviation of the averaged humidity (%RH), sample deviation / sqrt(samples)*/
+    uint8_t samples;/**<Number of conversions that passed the CRC check and were averaged*/
+    int ERR;
+  }sOversampledRHAndTemp_t;
   
   /**
    * @struct sMode_t
@@ -164,6 +198,17 @@ public:
     float lowSet;/**<Define the temperature (C)/humidity (%RH) range low threshold,ALERT generates a high-level alarm once the data lower than the value defined>*/
     float lowClear;/**<Clear the alarm once the temperature (C)/humidity (%RH) more than the value defined>*/
   } sLimitData_t;
+
+  /**
+   * @struct sConfigSnapshot_t
+   * @brief Compact copy of the configuration written to the chip, replayed after a reset
+   */
+  typedef struct{
+    uint16_t periodicCmd;/**<Command that started the cycle measurement mode, 0 in single measurement mode*/
+    uint16_t limit[4];/**<Raw alert limit words: high set, high clear, low clear, low set*/
+    uint8_t limitMask;/**<Bit n set when limit[n] was written*/
+    uint8_t heater;/**<1 when the heater was turned on*/
+  } sConfigSnapshot_t;
   
 public:
 
@@ -178,6 +223,32 @@ public:
    * @n When the ADR is connected to GND, the chip IIC address is 0x44.
    */
   DFRobot_SHT3x(TwoWire *pWire = &Wire, uint8_t address = 0x45,uint8_t RST = 4);
+
+  /**
+   * @fn DFRobot_SHT3x
+   * @brief Construct the function for a chip behind an I2C multiplexer, its channel is selected before every transfer.
+   * @n A transfer whose channel cannot be selected is not sent and reads as a NACK of the chip, the next transfer
+   * @n selects the channel again. A NACK of the chip keeps the channel, checkReset() selects it again.
+   * @param pMux  Multiplexer the chip is behind, its bus is used.
+   * @param channel  Multiplexer channel of the chip.
+   * @param address Chip IIC address, 0x44 or 0x45(0x45 in default).
+   * @param RST Chip reset pin, 4 in default.
+   */
+  DFRobot_SHT3x(DFRobot_SHT3x_Mux *pMux,uint8_t channel,uint8_t address = 0x45,uint8_t RST = 4);
+
+  /**
+   * @fn getMux
+   * @brief Get the multiplexer the chip is behind
+   * @return Return the multiplexer, NULL when the chip is directly on the bus
+   */
+  DFRobot_SHT3x_Mux *getMux();
+
+  /**
+   * @fn getMuxChannel
+   * @brief Get the multiplexer channel of the chip
+   * @return Return the channel, SHT3X_MUX_NO_CHANNEL when the chip is directly on the bus
+   */
+  uint8_t getMuxChannel();
   
   /**
    * @fn readSerialNumber
@@ -188,10 +259,33 @@ public:
   
   /**
    * @fn begin
-   * @brief Initialize the function
+   * @brief Initialize the function, the status register is cleared so that the power-up reset flag is not taken for a later reset.
    * @return Return 0 indicates a successful initialization, while other values indicates failure and return to error code.
    */
   int begin();
+
+  /**
+   * @fn begin
+   * @brief Warm start after the MCU woke up from deep sleep, using the serial number and the configuration kept in
+   * @n retained RAM. The serial number is not read again, a single status register read checks that the chip is
+   * @n present; the configuration is written back only if the chip was reset in between (e.g. it was powered down
+   * @n with the MCU), otherwise nothing is written and a periodic measurement can be fetched right away.
+   * @n The status read goes to a running cycle without a break, which the chip answers.
+   * @n The reset is seen through systemResetDeteced, so the flag must be clear when the snapshot is taken: the cold
+   * @n begin() and startPeriodicMode() clear it, after a later softReset() or pinReset() call clearStatusRegister().
+   * @n On a false alarm the configuration is written to the running chip, which takes these commands during the cycle.
+   * @param serialNumber  Serial number got from getSerialNumber() after a cold begin().
+   * @param snapshot  Configuration got from getConfigSnapshot() before sleeping.
+   * @return Return 0 indicates a successful initialization, while other values indicates failure and return to error code.
+   */
+  int begin(uint32_t serialNumber,const sConfigSnapshot_t &snapshot);
+
+  /**
+   * @fn getSerialNumber
+   * @brief Get the serial number read by begin() or given to the warm start begin(), no bus access
+   * @return 32-digit serial number, 0 before begin()
+   */
+  uint32_t getSerialNumber();
   
   /**
    * @fn softReset
@@ -216,6 +310,22 @@ public:
    * @n A status of 0 indicates the right return data.
    */
   sRHAndTemp_t readTemperatureAndHumidity(eRepeatability_t repeatability );
+
+  /**
+   * @fn startMeasurement
+   * @brief Send a single measurement command and return at once, the chip answers NACK until the conversion is done
+   * @n (SHT3X_CONVERSION_TIME_H_MS, _M_MS or _L_MS), then the result is read by readMeasurement().
+   * @param repeatability Set repeatability to read temperature and humidity data with the type eRepeatability_t.
+   */
+  void startMeasurement(eRepeatability_t repeatability = eRepeatability_High);
+
+  /**
+   * @fn readMeasurement
+   * @brief Read the result of the measurement started by startMeasurement(), does not wait.
+   * @param data  Receive the temperature and humidity, ERR is set to the return value.
+   * @return Return 0 indicates the right return data, ERR_NOT_READY when the conversion is not done, -1 when the CRC check failed.
+   */
+  int readMeasurement(sRHAndTemp_t &data);
   
   /**
    * @fn getTemperatureC
@@ -224,12 +334,14 @@ public:
    */
   float getTemperatureC();
   
+#ifndef SHT3X_DISABLE_FAHRENHEIT
   /**
    * @fn getTemperatureF
    * @brief Get the measured temperature (in degrees Fahrenheit)
    * @return Return the float temperature data 
    */
   float getTemperatureF();
+#endif
   
   /**
    * @fn getHumidityRH
@@ -237,6 +349,20 @@ public:
    * @return Return the float humidity data
    */
   float getHumidityRH();
+
+  /**
+   * @fn getRawTemperature
+   * @brief Get the raw temperature word of the last successful read, no measurement is started.
+   * @return Return the raw word, °C = 175 * raw / 65535 - 45
+   */
+  uint16_t getRawTemperature();
+
+  /**
+   * @fn getRawHumidity
+   * @brief Get the raw humidity word of the last successful read, no measurement is started.
+   * @return Return the raw word, %RH = 100 * raw / 65535
+   */
+  uint16_t getRawHumidity();
   
   /**
    * @fn startPeriodicMode
@@ -246,6 +372,7 @@ public:
    * @param repeatability  Set repeatability to read temperature and humidity data with the type eRepeatability_t. 
    * eRepeatability_High(high repeatability mode) in default.
    * @return Return true indicates a successful entrance to cycle measurement mode.
+   * @note To change the frequency of a running cycle call stopPeriodicMode() first.
    */
   bool startPeriodicMode(eMeasureFrequency_t measureFreq,eRepeatability_t repeatability = eRepeatability_High);
   
@@ -256,6 +383,20 @@ public:
    * @n A status of 0 indicates the right return data.
    */
   sRHAndTemp_t readTemperatureAndHumidity();
+
+  /**
+   * @fn readTemperatureAndHumidity
+   * @brief Oversampling: take several single measurements back-to-back and return their average.
+   * @details Each conversion only waits for its own repeatability (datasheet max: high 15.5ms, medium 6.5ms, low 4.5ms),
+   * @n so averaging several low repeatability conversions can beat one high repeatability conversion on noise per ms.
+   * @n The attached statistics accumulator receives the averaged sample only.
+   * @param repeatability  Repeatability of each conversion with the type eRepeatability_t.
+   * @param samples  Number of conversions to average, 1 to 255.
+   * @return Return a structure containing the averaged data, the noise estimate of each channel and a status code
+   * @n A status of 0 indicates the right return data, -1 means no conversion passed the CRC check.
+   * @note Only works in single measurement mode.
+   */
+  sOversampledRHAndTemp_t readTemperatureAndHumidity(eRepeatability_t repeatability,uint8_t samples);
   
   /**
    * @fn stopPeriodicMode
@@ -267,18 +408,24 @@ public:
   /**
    * @fn heaterEnable
    * @brief Turn on the heater inside the chip
+   * @param verify  Read the status register back after the command, true in default. 
+   * @n false only sends the command and returns true, it does not block on the status read. The command is left
+   * @n for verifyCommands() only when setCommandVerification(false) was called.
    * @return Read the status of the register to determine whether the command was executed successfully, and returning true indicates success
    * @note Heaters should be used in wet environments, and other cases of use will result in incorrect readings
    */
-  bool heaterEnable();
+  bool heaterEnable(bool verify = true);
   
   /**
    * @fn heaterDisable
    * @brief Turn off the heater inside the chip
+   * @param verify  Read the status register back after the command, true in default. 
+   * @n false only sends the command and returns true, it does not block on the status read. The command is left
+   * @n for verifyCommands() only when setCommandVerification(false) was called.
    * @return Read the status of the register to determine whether the command was executed successfully, and returning true indicates success
    * @note Heaters should be used in wet environments, and other cases of use will result in incorrect readings
    */
-  bool heaterDisable();
+  bool heaterDisable(bool verify = true);
   
   /**
    * @fn clearStatusRegister
@@ -286,6 +433,96 @@ public:
    * @n  Set bit:15 to 0 so that ALERT pin can work, otherwise it will keep high.
    */
   void clearStatusRegister();
+
+  /**
+   * @fn setCommandVerification
+   * @brief Choose whether softReset, startPeriodicMode, stopPeriodicMode, heaterEnable and heaterDisable read the
+   * @n status register back after their command.
+   * @param enable  true (in default): every command is verified at once, false: the commands only send their bytes
+   * @n and return true, call verifyCommands() once after a batch of commands.
+   */
+  void setCommandVerification(bool enable);
+
+  /**
+   * @fn verifyCommands
+   * @brief Verify the commands sent since the last verification with a single status register read.
+   * @details Checks commandStatus (last command processed) and writeDataChecksumStatus (last write with data),
+   * @n the heater bit against the last heater command of the batch and the reset bit if the batch contained a softReset.
+   * @n The chip only keeps the result of the last command, an invalid command in the middle of a batch is only
+   * @n seen through the state it should have changed.
+   * @return Return true when the status matches the batch, true as well when nothing is pending.
+   */
+  bool verifyCommands();
+
+  /**
+   * @fn getPendingCommands
+   * @brief Get the number of commands sent without verification since the last verifyCommands().
+   * @return Return the number of pending commands
+   */
+  uint8_t getPendingCommands();
+
+  /**
+   * @fn setAutoRestore
+   * @brief When a read fails its CRC check, a single measurement is not answered after its conversion time, or no
+   * @n sample came for two periods in cycle measurement mode, read the status register and restore the configuration
+   * @n if the chip was reset.
+   * @param enable  false in default.
+   * @note Good reads cost nothing. A failed read costs one status read (about 1 ms), up to 10 retries when the chip
+   * @n does not answer at all. A single NACK is not a failure in cycle measurement mode (no new sample yet).
+   * @n A reset that does not make a read fail (single measurement mode) is only seen by calling checkReset().
+   */
+  void setAutoRestore(bool enable);
+
+  /**
+   * @fn getAutoRestore
+   * @brief Get whether the automatic restore is on
+   * @return Return the value set by setAutoRestore()
+   */
+  bool getAutoRestore();
+
+  /**
+   * @fn checkReset
+   * @brief Read the status register once and restore the configuration if a reset (systemResetDeteced) is flagged.
+   * @return Return true when a reset was detected and the configuration restored, false when no reset is flagged
+   * @n or the status could not be read in 10 tries.
+   */
+  bool checkReset();
+
+  /**
+   * @fn startStatusRead
+   * @brief Send the status register read command and return at once, the status is read by readStatusResult().
+   */
+  void startStatusRead();
+
+  /**
+   * @fn readStatusResult
+   * @brief Read the status asked by startStatusRead() once, without the retries of the blocking status reads.
+   * @param status  Receive the status register
+   * @return Return 0 indicates the right return data, ERR_NOT_READY when the chip answered NACK, -1 when the CRC check failed.
+   */
+  int readStatusResult(sStatusRegister_t &status);
+
+  /**
+   * @fn restoreConfig
+   * @brief Replay the configuration snapshot with the minimum number of writes: clear status, the alert limits that
+   * @n were set, the heater if it was on and the cycle measurement command, without status read-back.
+   * @n No break is sent: the datasheet only recommends one before commands other than fetch during the cycle.
+   */
+  void restoreConfig();
+
+  /**
+   * @fn getConfigSnapshot
+   * @brief Get the configuration snapshot, e.g. to keep it in retained memory.
+   * @return Return the snapshot
+   */
+  const sConfigSnapshot_t &getConfigSnapshot();
+
+  /**
+   * @fn setConfigSnapshot
+   * @brief Replace the configuration snapshot, nothing is written to the chip.
+   * @param snapshot  Snapshot got from getConfigSnapshot().
+   */
+  void setConfigSnapshot(const sConfigSnapshot_t &snapshot);
   
   /**
    * @fn readAlertState
@@ -323,6 +560,7 @@ public:
    */
   uint8_t  setTemperatureLimitC(float highset,float highclear,float lowset,float lowclear);
   
+#ifndef SHT3X_DISABLE_FAHRENHEIT
   /**
    * @fn setTemperatureLimitF
    * @brief Set the threshold temperature and alarm clear temperature(°F)
@@ -334,6 +572,7 @@ public:
    * @return  A return to 0 indicates a successful setting.
    */
   uint8_t  setTemperatureLimitF(float highset,float highclear, float lowset,float lowclear);
+#endif
 
   /**
    * @fn setHumidityLimitRH
@@ -382,6 +621,7 @@ public:
    */
   float getTemperatureLowSetC();
   
+#ifndef SHT3X_DISABLE_FAHRENHEIT
   /**
    * @fn measureTemperatureLimitF
    * @brief Measure the threshold temperature and alarm clear temperature
@@ -416,6 +656,7 @@ public:
    * @return Return low temperature alarm points
    */
   float getTemperatureLowSetF();
+#endif
   
   /**
    * @fn measureHumidityLimitRH
@@ -452,6 +693,46 @@ public:
    */
   float getHumidityLowSetRH();
 
+  /**
+   * @fn attachStatistics
+   * @brief Feed every successful temperature and humidity read into a statistics accumulator.
+   * @param pStats  Accumulator to feed, NULL detaches it.
+   */
+  void attachStatistics(DFRobot_SHT3x_Stats *pStats);
+
+  /**
+   * @fn attachDeadband
+   * @brief Set the report-by-exception filter used by readTemperatureAndHumidityOnChange.
+   * @param pDeadband  Filter to use, NULL reports every sample.
+   */
+  void attachDeadband(DFRobot_SHT3x_Deadband *pDeadband);
+
+  /**
+   * @fn attachTrace
+   * @brief Log every bus write, bus read, command and delay of the driver into a timeline recorder.
+   * @param pTrace  Recorder to log into, NULL detaches it.
+   */
+  void attachTrace(DFRobot_SHT3x_Trace *pTrace);
+
+  /**
+   * @fn setTransport
+   * @brief Do the bus writes and reads through a transport instead of TwoWire, e.g. to capture or replay them.
+   * @param pTransport  Transport to use, NULL goes back to TwoWire.
+   */
+  void setTransport(DFRobot_SHT3x_Transport *pTransport);
+
+  /**
+   * @fn readTemperatureAndHumidityOnChange
+   * @brief Read one sample (single measurement or periodic fetch, depending on the current mode) and report it
+   * @n only when it left the deadband of the attached filter or the heartbeat expired.
+   * @details The filter compares raw words, a sample that is not reported is never converted.
+   * @param data  Receive the sample when it is reported. ERR is set to -1 on a CRC error, ERR_NOT_READY when the chip
+   * @n answered NACK (e.g. no new data yet in cycle measurement mode) and 0 when the sample was read but suppressed,
+   * @n the other fields then keep the last reported sample.
+   * @return Return true when the sample is reported, false when it is suppressed or could not be read.
+   */
+  bool readTemperatureAndHumidityOnChange(sRHAndTemp_t &data);
+
 private:
 
   /**
@@ -489,9 +770,60 @@ private:
    * @brief Write command to sensor chip.
    * @param pBuf  The data contained in the command.
    * @param size  Number of command data
-   * @return Return 0 indicates the successful read, other return values suggest unsuccessful read.
+   * @return Return the number of bytes the chip sent, 0 when it answered NACK.
    */
   uint8_t readData(void *pBuf,size_t size);
+
+  /**
+   * @fn readRawData
+   * @brief Send a measurement or fetch command and keep the two raw 16-bit words, no unit conversion is done here.
+   * @param cmd  Command that makes the chip output a temperature/humidity frame.
+   * @param waitMs  Time to wait for the conversion before reading the frame (ms).
+   * @return Return 0 when both words pass the CRC check, ERR_NOT_READY when the chip answered NACK, -1 otherwise.
+   */
+  int readRawData(uint16_t cmd,uint8_t waitMs);
+
+  /**
+   * @fn readRawResult
+   * @brief Read the 6-byte frame of a command sent before and keep the two raw words.
+   * @return Return 0 when both words pass the CRC check, ERR_NOT_READY when the chip answered NACK, -1 otherwise.
+   */
+  int readRawResult();
+
+  /**
+   * @fn getPeriodMs
+   * @brief Get the measurement period of the cycle measurement command of the snapshot, 2000ms when there is none.
+   */
+  uint16_t getPeriodMs();
+
+  /**
+   * @fn readRawData
+   * @brief Read the raw words using the command matching the current measurement mode.
+   * @return Return 0 when both words pass the CRC check, ERR_NOT_READY when the chip answered NACK, -1 otherwise.
+   */
+  int readRawData();
+
+  /**
+   * @fn convertRawData
+   * @brief Convert the last raw words into tempRH, only the units enabled at compile time are computed.
+   */
+  void convertRawData();
+
+  /**
+   * @fn measureTemperatureLimit
+   * @brief Read the four temperature alert limits into limitData.
+   * @param fahrenheit  Store the limits in °F instead of °C.
+   * @return Return true indicates successful data acquisition
+   */
+  bool measureTemperatureLimit(bool fahrenheit);
+
+  /**
+   * @fn deferVerification
+   * @brief Record what verifyCommands() has to check for a command sent without verification.
+   * @param heater  Expected heater bit, -1 when the command does not change it.
+   * @param reset  The command resets the chip.
+   */
+  void deferVerification(int8_t heater,bool reset);
   
   /**
    * @fn checkCrc
@@ -508,6 +840,7 @@ private:
    * @return Celsius temperature.
    */
   float convertTemperature(uint8_t rawTemperature[]);
+  float convertTemperature(uint16_t rawValue);
   /**
    * @fn convertHumidity
    * @brief Convert the data returned from the sensor to relative humidity.
@@ -515,6 +848,7 @@ private:
    * @return Relative humidity.
    */
   float convertHumidity(uint8_t rawHumidity[]);
+  float convertHumidity(uint16_t rawValue);
   
   /**
    * @fn convertRawTemperature
@@ -549,14 +883,39 @@ private:
    * @brief Transport data to chip
    * @param Data address
    * @param Data length
+   * @return Return 0 when the chip acknowledged, nonzero when it or the multiplexer answered NACK
+   */
+  uint8_t write(const void* pBuf,size_t size);
+
+  /**
+   * @fn wait
+   * @brief Blocking delay of the driver, logged into the attached trace recorder.
+   * @param ms  Time to wait (ms)
    */
-  void write(const void* pBuf,size_t size);
+  void wait(uint16_t ms);
   
 private:
 
   sLimitData_t limitData;
   sRHAndTemp_t tempRH;
+  uint16_t rawTemperature;
+  uint16_t rawHumidity;
   TwoWire *_pWire;
+  DFRobot_SHT3x_Stats *_pStats;
+  DFRobot_SHT3x_Deadband *_pDeadband;
+  DFRobot_SHT3x_Trace *_pTrace;
+  DFRobot_SHT3x_Mux *_pMux;
+  uint8_t _muxChannel;
+  DFRobot_SHT3x_Transport *_pTransport;
+  bool _verifyCommands;
+  uint8_t _pendingCommands;
+  int8_t _expectHeater;
+  bool _expectReset;
+  bool _autoRestore;
+  bool _notReady;
+  uint32_t _notReadySince;
+  sConfigSnapshot_t _snapshot;
+  uint32_t _serialNumber;
   eMode_t measurementMode ;
   uint8_t _address;
   uint8_t _RST;
@@ -0,0 +1,133 @@
+/*!
+ * @file DFRobot_SHT3x_AdaptiveRate.cpp
+ * @brief Implementation of the adaptive measurement frequency controller of the DFRobot_SHT3x class
+ * 
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include <DFRobot_SHT3x_AdaptiveRate.h>
+
+DFRobot_SHT3x_AdaptiveRate::DFRobot_SHT3x_AdaptiveRate(DFRobot_SHT3x &sht3x)
+{
+  _pSht3x = &sht3x;
+  _repeatability = DFRobot_SHT3x::eRepeatability_High;
+  _minFreq = DFRobot_SHT3x::eMeasureFreq_Hz5;
+  _maxFreq = DFRobot_SHT3x::eMeasureFreq_10Hz;
+  _freq = _minFreq;
+  _hold = 10;
+  _stable = 0;
+  _valid = false;
+  _lastTime = 0;
+  _rate[0] = 0;
+  _rate[1] = 0;
+  setThresholds(0.5f,0.1f,2.0f,0.5f);
+}
+
+bool DFRobot_SHT3x_AdaptiveRate::begin(DFRobot_SHT3x::eMeasureFrequency_t minFreq,DFRobot_SHT3x::eMeasureFrequency_t maxFreq,DFRobot_SHT3x::eRepeatability_t repeatability)
+{
+  if(minFreq > maxFreq){
+    return false;
+  }
+  _minFreq = minFreq;
+  _maxFreq = maxFreq;
+  _repeatability = repeatability;
+  _stable = 0;
+  _valid = false;
+  _rate[0] = 0;
+  _rate[1] = 0;
+  _freq = _minFreq;
+  return _pSht3x->startPeriodicMode(minFreq,repeatability);
+}
+
+void DFRobot_SHT3x_AdaptiveRate::setThresholds(float attackC,float releaseC,float attackRH,float releaseRH)
+{
+  //Thresholds are kept in raw counts per second so that every sample is checked with integer math
+  _attack[0] = attackC * 65535.0f / 175.0f;
+  _release[0] = releaseC * 65535.0f / 175.0f;
+  _attack[1] = attackRH * 65535.0f / 100.0f;
+  _release[1] = releaseRH * 65535.0f / 100.0f;
+}
+
+void DFRobot_SHT3x_AdaptiveRate::setHoldSamples(uint8_t samples)
+{
+  _hold = samples;
+}
+
+DFRobot_SHT3x::eMeasureFrequency_t DFRobot_SHT3x_AdaptiveRate::getFrequency()
+{
+  return (DFRobot_SHT3x::eMeasureFrequency_t)_freq;
+}
+
+uint16_t DFRobot_SHT3x_AdaptiveRate::getPeriodMs()
+{
+  const uint16_t periodMs[5] = {2000,1000,500,250,100};
+  return periodMs[_freq];
+}
+
+void DFRobot_SHT3x_AdaptiveRate::smoothRate(uint8_t channel,uint16_t current,uint32_t dt)
+{
+  int32_t r = ((int32_t)current - (int32_t)_last[channel]) * 1000L / (int32_t)dt;
+  //Weight of the new sample out of 256, dt / (dt + time constant): the same smoothing time at every frequency
+  int32_t weight = dt >= 0x10000UL ? 255 : (int32_t)(dt * 256UL / (dt + SHT3X_RATE_TIME_CONSTANT));
+  //The signed differences of the noise cancel out in the average, a real trend adds up
+  _rate[channel] += (r - _rate[channel]) * weight / 256;
+}
+
+bool DFRobot_SHT3x_AdaptiveRate::setFrequency(uint8_t freq)
+{
+  if(freq == _freq){
+    return true;
+  }
+  DBG(freq);
+  _pSht3x->stopPeriodicMode();
+  if(!_pSht3x->startPeriodicMode((DFRobot_SHT3x::eMeasureFrequency_t)freq,_repeatability)){
+    return false;
+  }
+  _freq = freq;
+  return true;
+}
+
+DFRobot_SHT3x::sRHAndTemp_t DFRobot_SHT3x_AdaptiveRate::readTemperatureAndHumidity()
+{
+  DFRobot_SHT3x::sRHAndTemp_t data = _pSht3x->readTemperatureAndHumidity();
+  uint16_t current[2];
+  uint32_t now = millis();
+  uint32_t dt = now - _lastTime;
+  bool attack = false;
+  bool release = true;
+  if(data.ERR != 0){
+    return data;
+  }
+  current[0] = _pSht3x->getRawTemperature();
+  current[1] = _pSht3x->getRawHumidity();
+  if(_valid && dt){
+    for(uint8_t i = 0; i < 2; i++){
+      smoothRate(i,current[i],dt);
+      uint32_t r = _rate[i] < 0 ? -_rate[i] : _rate[i];
+      if(_attack[i] && r > _attack[i]) attack = true;
+      if(_release[i] && r >= _release[i]) release = false;
+    }
+    if(attack){
+      _stable = 0;
+      setFrequency(_maxFreq);
+    } else if(release){
+      if(++_stable >= _hold && _freq > _minFreq){
+        _stable = 0;
+        setFrequency(_freq - 1);
+      }
+    } else {
+      //Between the two thresholds: keep the current frequency
+      _stable = 0;
+    }
+  }
+  _last[0] = current[0];
+  _last[1] = current[1];
+  _lastTime = now;
+  _valid = true;
+  return data;
+}
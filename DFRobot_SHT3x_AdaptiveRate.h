@@ -0,0 +1,118 @@
+/*!
+ * @file DFRobot_SHT3x_AdaptiveRate.h
+ * @brief Define the infrastructure of the DFRobot_SHT3x_AdaptiveRate class
+ * @details Adaptive measurement frequency for the cycle measurement mode: the controller jumps to the fastest allowed
+ * @n frequency as soon as the temperature or the humidity changes faster than the attack threshold, and steps back down
+ * @n one frequency at a time once the signal stayed below the (lower) release threshold for a number of samples.
+ * @n The gap between the two thresholds and the hold count keep the controller from thrashing the mode switch.
+ * @n The rate of change is the difference between two samples averaged with a time constant of
+ * @n SHT3X_RATE_TIME_CONSTANT, so the sensor noise, which a single difference divides by a short period, does not
+ * @n keep the fast frequencies above the release thresholds.
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef DFROBOT_SHT3X_ADAPTIVERATE_H
+#define DFROBOT_SHT3X_ADAPTIVERATE_H
+#include "DFRobot_SHT3x.h"
+
+#define SHT3X_RATE_TIME_CONSTANT   1000   ///< Time constant of the rate of change average (ms)
+
+class DFRobot_SHT3x_AdaptiveRate
+{
+public:
+
+  /**
+   * @fn DFRobot_SHT3x_AdaptiveRate
+   * @brief Construct the function
+   * @param sht3x  Driver of the sensor to control.
+   */
+  DFRobot_SHT3x_AdaptiveRate(DFRobot_SHT3x &sht3x);
+
+  /**
+   * @fn begin
+   * @brief Enter cycle measurement mode at the lowest frequency.
+   * @param minFreq  Frequency used while the signal is stable, eMeasureFreq_Hz5 in default.
+   * @param maxFreq  Frequency used while the signal changes fast, eMeasureFreq_10Hz in default.
+   * @param repeatability  Repeatability used at every frequency, eRepeatability_High in default.
+   * @return Return true indicates a successful entrance to cycle measurement mode.
+   */
+  bool begin(DFRobot_SHT3x::eMeasureFrequency_t minFreq = DFRobot_SHT3x::eMeasureFreq_Hz5,
+             DFRobot_SHT3x::eMeasureFrequency_t maxFreq = DFRobot_SHT3x::eMeasureFreq_10Hz,
+             DFRobot_SHT3x::eRepeatability_t repeatability = DFRobot_SHT3x::eRepeatability_High);
+
+  /**
+   * @fn setThresholds
+   * @brief Set the rate of change thresholds, a channel set to 0 is ignored.
+   * @param attackC  Temperature rate (°C/s) above which the fastest frequency is used, 0.5 in default.
+   * @param releaseC  Temperature rate (°C/s) below which the signal counts as stable, 0.1 in default.
+   * @param attackRH  Humidity rate (%RH/s) above which the fastest frequency is used, 2.0 in default.
+   * @param releaseRH  Humidity rate (%RH/s) below which the signal counts as stable, 0.5 in default.
+   * @note release must be lower than attack, the gap is the hysteresis.
+   */
+  void setThresholds(float attackC,float releaseC,float attackRH,float releaseRH);
+
+  /**
+   * @fn setHoldSamples
+   * @brief Set how many stable samples in a row are needed before stepping down one frequency.
+   * @param samples  10 in default.
+   */
+  void setHoldSamples(uint8_t samples);
+
+  /**
+   * @fn readTemperatureAndHumidity
+   * @brief Fetch the latest sample and adapt the measurement frequency to its rate of change.
+   * @return Return a structure containing celsius temperature (°C), Fahrenheit temperature (°F), relative humidity (%RH), status code
+   * @n A status of 0 indicates the right return data.
+   */
+  DFRobot_SHT3x::sRHAndTemp_t readTemperatureAndHumidity();
+
+  /**
+   * @fn getFrequency
+   * @brief Get the measurement frequency currently used.
+   * @return Return the frequency with the type eMeasureFrequency_t
+   */
+  DFRobot_SHT3x::eMeasureFrequency_t getFrequency();
+
+  /**
+   * @fn getPeriodMs
+   * @brief Get the measurement period currently used, fetch samples at this interval.
+   * @return Return the period (ms)
+   */
+  uint16_t getPeriodMs();
+
+private:
+
+  /**
+   * @fn setFrequency
+   * @brief Switch the chip to another frequency, stopPeriodicMode followed by startPeriodicMode.
+   */
+  bool setFrequency(uint8_t freq);
+
+  /**
+   * @fn smoothRate
+   * @brief Add the rate of change of a raw word since the last sample to the average of its channel (counts per second).
+   */
+  void smoothRate(uint8_t channel,uint16_t current,uint32_t dt);
+
+private:
+
+  DFRobot_SHT3x *_pSht3x;
+  DFRobot_SHT3x::eRepeatability_t _repeatability;
+  uint32_t _attack[2];
+  uint32_t _release[2];
+  uint32_t _lastTime;
+  int32_t _rate[2];
+  uint16_t _last[2];
+  uint8_t _minFreq;
+  uint8_t _maxFreq;
+  uint8_t _freq;
+  uint8_t _hold;
+  uint8_t _stable;
+  bool _valid;
+};
+#endif
@@ -0,0 +1,123 @@
+/*!
+ * @file DFRobot_SHT3x_AlertEngine.cpp
+ * @brief Implementation of the software threshold engine of the DFRobot_SHT3x class
+ * 
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include <DFRobot_SHT3x_AlertEngine.h>
+
+#define ALERT_STATE_HIGH    0x01
+#define ALERT_STATE_LOW     0x02
+
+DFRobot_SHT3x_AlertEngine::DFRobot_SHT3x_AlertEngine(sRule_t *rules,uint16_t capacity)
+{
+  _pRules = rules;
+  _capacity = capacity;
+  _count = 0;
+}
+
+uint16_t DFRobot_SHT3x_AlertEngine::toRaw(eChannel_t channel,float value)
+{
+  float raw;
+  if(channel == eTemperature){
+    raw = (value + 45.0f) * 65535.0f / 175.0f;
+  } else {
+    raw = value * 65535.0f / 100.0f;
+  }
+  if(raw <= 0.0f){
+    return 0;
+  } else if(raw >= 65535.0f){
+    return 0xFFFF;
+  }
+  return (uint16_t)(raw + 0.5f);
+}
+
+int16_t DFRobot_SHT3x_AlertEngine::addRule(uint16_t sensor,eChannel_t channel,float highSet,float highClear,float lowClear,float lowSet)
+{
+  sRule_t rule;
+  rule.highSet = toRaw(channel,highSet);
+  rule.highClear = toRaw(channel,highClear);
+  rule.lowClear = toRaw(channel,lowClear);
+  rule.lowSet = toRaw(channel,lowSet);
+  rule.sensor = sensor;
+  rule.channel = channel;
+  return addRawRule(rule);
+}
+
+int16_t DFRobot_SHT3x_AlertEngine::addRawRule(const sRule_t &rule)
+{
+  if(_count >= _capacity){
+    return -1;
+  }
+  _pRules[_count] = rule;
+  _pRules[_count].state = 0;
+  return _count++;
+}
+
+void DFRobot_SHT3x_AlertEngine::clear()
+{
+  _count = 0;
+}
+
+uint16_t DFRobot_SHT3x_AlertEngine::getRuleCount()
+{
+  return _count;
+}
+
+uint16_t DFRobot_SHT3x_AlertEngine::evaluate(const sSample_t *samples,uint16_t sensorCount,sEvent_t *events,uint16_t maxEvents)
+{
+  uint16_t n = 0;
+  for(uint16_t i = 0; i < _count; i++){
+    sRule_t &rule = _pRules[i];
+    uint16_t value;
+    uint8_t state,changed;
+    if(rule.sensor >= sensorCount){
+      continue;
+    }
+    value = (rule.channel == eTemperature) ? samples[rule.sensor].rawTemperature : samples[rule.sensor].rawHumidity;
+    //Hysteresis: an active alert stays until the value crosses its clear threshold
+    state = 0;
+    if(value > rule.highSet || ((rule.state & ALERT_STATE_HIGH) && value >= rule.highClear)){
+      state |= ALERT_STATE_HIGH;
+    }
+    if(value < rule.lowSet || ((rule.state & ALERT_STATE_LOW) && value <= rule.lowClear)){
+      state |= ALERT_STATE_LOW;
+    }
+    changed = state ^ rule.state;
+    if(!changed){
+      continue;
+    }
+    //Both windows can change at once on a large step, keep the rule unchanged if its events do not fit
+    if(n + ((changed == (ALERT_STATE_HIGH | ALERT_STATE_LOW)) ? 2 : 1) > maxEvents){
+      break;
+    }
+    if(changed & ALERT_STATE_HIGH){
+      events[n].rule = i;
+      events[n].sensor = rule.sensor;
+      events[n].transition = (state & ALERT_STATE_HIGH) ? eHighSet : eHighCleared;
+      n++;
+    }
+    if(changed & ALERT_STATE_LOW){
+      events[n].rule = i;
+      events[n].sensor = rule.sensor;
+      events[n].transition = (state & ALERT_STATE_LOW) ? eLowSet : eLowCleared;
+      n++;
+    }
+    rule.state = state;
+  }
+  return n;
+}
+
+bool DFRobot_SHT3x_AlertEngine::isActive(uint16_t rule)
+{
+  if(rule >= _count){
+    return false;
+  }
+  return _pRules[rule].state != 0;
+}
@@ -0,0 +1,154 @@
+/*!
+ * @file DFRobot_SHT3x_AlertEngine.h
+ * @brief Define the infrastructure of the DFRobot_SHT3x_AlertEngine class
+ * @details Software threshold engine for many rules over many sensors, e.g. on a gateway. Each rule holds a high
+ * @n window (set/clear) and a low window (set/clear) on one channel of one sensor, like the ALERT limits of the chip,
+ * @n but kept as full 16-bit raw words and with as many rules per sensor as needed. The rules live in a packed 12-byte
+ * @n table given by the caller, the alert state bits sit inside each rule, and evaluate() walks the table once per
+ * @n batch of raw samples with integer compares only, reporting the transitions only.
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef DFROBOT_SHT3X_ALERTENGINE_H
+#define DFROBOT_SHT3X_ALERTENGINE_H
+#include "Arduino.h"
+
+class DFRobot_SHT3x_AlertEngine
+{
+public:
+
+  /**
+   * @enum eChannel_t
+   * @brief Channel watched by a rule
+   */
+  typedef enum{
+    eTemperature = 0,/**<Temperature*/
+    eHumidity = 1,/**<Relative humidity*/
+  } eChannel_t;
+
+  /**
+   * @enum eTransition_t
+   * @brief Change of the alert state of a rule
+   */
+  typedef enum{
+    eHighSet = 0,/**<The value went above highSet*/
+    eHighCleared = 1,/**<The value went back below highClear*/
+    eLowSet = 2,/**<The value went below lowSet*/
+    eLowCleared = 3,/**<The value went back above lowClear*/
+  } eTransition_t;
+
+  /**
+   * @struct sRule_t
+   * @brief One rule, raw sensor words. Set highSet to 0xFFFF or lowSet to 0 to disable a window.
+   */
+  typedef struct{
+    uint16_t highSet;/**<High alert when the value is greater than this*/
+    uint16_t highClear;/**<High alert cleared when the value is less than this, not above highSet*/
+    uint16_t lowClear;/**<Low alert cleared when the value is greater than this, not below lowSet*/
+    uint16_t lowSet;/**<Low alert when the value is less than this*/
+    uint16_t sensor;/**<Index of the sensor in the sample batch*/
+    uint8_t channel;/**<eTemperature or eHumidity*/
+    uint8_t state;/**<Bit 0: high alert active, bit 1: low alert active*/
+  } sRule_t;
+
+  /**
+   * @struct sSample_t
+   * @brief Raw sample of one sensor, a batch is indexed by the sensor number of the rules
+   */
+  typedef struct{
+    uint16_t rawTemperature;
+    uint16_t rawHumidity;
+  } sSample_t;
+
+  /**
+   * @struct sEvent_t
+   * @brief One transition reported by evaluate()
+   */
+  typedef struct{
+    uint16_t rule;/**<Index of the rule returned by addRule()*/
+    uint16_t sensor;/**<Sensor of the rule*/
+    uint8_t transition;/**<eTransition_t*/
+  } sEvent_t;
+
+public:
+
+  /**
+   * @fn DFRobot_SHT3x_AlertEngine
+   * @brief Construct the function
+   * @param rules  Storage of the rule table, owned by the caller (no dynamic allocation).
+   * @param capacity  Number of rules the storage holds.
+   */
+  DFRobot_SHT3x_AlertEngine(sRule_t *rules,uint16_t capacity);
+
+  /**
+   * @fn addRule
+   * @brief Add a rule in physical units. Adding the rules of a sensor next to each other keeps evaluate() local in memory.
+   * @param sensor  Index of the sensor in the sample batch.
+   * @param channel  eTemperature (°C) or eHumidity (%RH).
+   * @param highSet  High alert threshold.
+   * @param highClear  High alert clear threshold, not above highSet.
+   * @param lowClear  Low alert clear threshold, not below lowSet.
+   * @param lowSet  Low alert threshold.
+   * @return Return the index of the rule, -1 when the table is full
+   */
+  int16_t addRule(uint16_t sensor,eChannel_t channel,float highSet,float highClear,float lowClear,float lowSet);
+
+  /**
+   * @fn addRawRule
+   * @brief Add a rule in raw sensor words, the state of the rule starts cleared.
+   * @return Return the index of the rule, -1 when the table is full
+   */
+  int16_t addRawRule(const sRule_t &rule);
+
+  /**
+   * @fn clear
+   * @brief Remove every rule.
+   */
+  void clear();
+
+  /**
+   * @fn getRuleCount
+   * @brief Get the number of rules
+   * @return Return the count
+   */
+  uint16_t getRuleCount();
+
+  /**
+   * @fn evaluate
+   * @brief Evaluate every rule against a batch of raw samples in one pass.
+   * @param samples  Raw samples, samples[n] belongs to sensor n.
+   * @param sensorCount  Number of samples, the rules of sensors beyond it are skipped.
+   * @param events  Receive the transitions.
+   * @param maxEvents  Size of events. When it is full the pass stops, the remaining transitions are reported by the next call.
+   * @return Return the number of transitions written to events
+   */
+  uint16_t evaluate(const sSample_t *samples,uint16_t sensorCount,sEvent_t *events,uint16_t maxEvents);
+
+  /**
+   * @fn isActive
+   * @brief Get the alert state of a rule.
+   * @param rule  Index returned by addRule().
+   * @return Return true while the high or the low alert of the rule is active
+   */
+  bool isActive(uint16_t rule);
+
+private:
+
+  /**
+   * @fn toRaw
+   * @brief Convert °C or %RH into the raw word, clamped to 0..0xFFFF.
+   */
+  static uint16_t toRaw(eChannel_t channel,float value);
+
+private:
+
+  sRule_t *_pRules;
+  uint16_t _capacity;
+  uint16_t _count;
+};
+#endif
@@ -0,0 +1,358 @@
+/*!
+ * @file DFRobot_SHT3x_Batch.cpp
+ * @brief Implementation of the batch frame conversion of the DFRobot_SHT3x class for Linux gateways
+ * 
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include "DFRobot_SHT3x_Batch.h"
+#if defined(__linux__) && !defined(ARDUINO)
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SHT3X_BATCH_X86
+#elif defined(__aarch64__) && defined(SHT3X_BATCH_ENABLE_NEON)
+//Not delivered: the kernel has never been run, it is built on request to be checked with extras/batchBenchmark
+#include <arm_neon.h>
+#define SHT3X_BATCH_NEON
+#endif
+
+#define CRC_POLYNOMIAL    0x31
+#define CRC_INIT          0xFF
+
+typedef size_t (*kernel_t)(const uint8_t *frames,size_t count,float *temperatureC,float *humidity,uint8_t *valid);
+
+//CRC-8 of one byte, polynomial 0x31, MSB first: crc = crcTable[crc ^ byte]
+static const uint8_t crcTable[256] = {
+  0x00,0x31,0x62,0x53,0xC4,0xF5,0xA6,0x97,0xB9,0x88,0xDB,0xEA,0x7D,0x4C,0x1F,0x2E,
+  0x43,0x72,0x21,0x10,0x87,0xB6,0xE5,0xD4,0xFA,0xCB,0x98,0xA9,0x3E,0x0F,0x5C,0x6D,
+  0x86,0xB7,0xE4,0xD5,0x42,0x73,0x20,0x11,0x3F,0x0E,0x5D,0x6C,0xFB,0xCA,0x99,0xA8,
+  0xC5,0xF4,0xA7,0x96,0x01,0x30,0x63,0x52,0x7C,0x4D,0x1E,0x2F,0xB8,0x89,0xDA,0xEB,
+  0x3D,0x0C,0x5F,0x6E,0xF9,0xC8,0x9B,0xAA,0x84,0xB5,0xE6,0xD7,0x40,0x71,0x22,0x13,
+  0x7E,0x4F,0x1C,0x2D,0xBA,0x8B,0xD8,0xE9,0xC7,0xF6,0xA5,0x94,0x03,0x32,0x61,0x50,
+  0xBB,0x8A,0xD9,0xE8,0x7F,0x4E,0x1D,0x2C,0x02,0x33,0x60,0x51,0xC6,0xF7,0xA4,0x95,
+  0xF8,0xC9,0x9A,0xAB,0x3C,0x0D,0x5E,0x6F,0x41,0x70,0x23,0x12,0x85,0xB4,0xE7,0xD6,
+  0x7A,0x4B,0x18,0x29,0xBE,0x8F,0xDC,0xED,0xC3,0xF2,0xA1,0x90,0x07,0x36,0x65,0x54,
+  0x39,0x08,0x5B,0x6A,0xFD,0xCC,0x9F,0xAE,0x80,0xB1,0xE2,0xD3,0x44,0x75,0x26,0x17,
+  0xFC,0xCD,0x9E,0xAF,0x38,0x09,0x5A,0x6B,0x45,0x74,0x27,0x16,0x81,0xB0,0xE3,0xD2,
+  0xBF,0x8E,0xDD,0xEC,0x7B,0x4A,0x19,0x28,0x06,0x37,0x64,0x55,0xC2,0xF3,0xA0,0x91,
+  0x47,0x76,0x25,0x14,0x83,0xB2,0xE1,0xD0,0xFE,0xCF,0x9C,0xAD,0x3A,0x0B,0x58,0x69,
+  0x04,0x35,0x66,0x57,0xC0,0xF1,0xA2,0x93,0xBD,0x8C,0xDF,0xEE,0x79,0x48,0x1B,0x2A,
+  0xC1,0xF0,0xA3,0x92,0x05,0x34,0x67,0x56,0x78,0x49,0x1A,0x2B,0xBC,0x8D,0xDE,0xEF,
+  0x82,0xB3,0xE0,0xD1,0x46,0x77,0x24,0x15,0x3B,0x0A,0x59,0x68,0xFF,0xCE,0x9D,0xAC,
+};
+
+static size_t convertScalar(const uint8_t *frames,size_t count,float *temperatureC,float *humidity,uint8_t *valid)
+{
+  size_t n = 0;
+  for(size_t i = 0; i < count; i++){
+    const uint8_t *f = frames + i * SHT3X_FRAME_SIZE;
+    uint8_t ok = (crcTable[crcTable[CRC_INIT ^ f[0]] ^ f[1]] == f[2]) & (crcTable[crcTable[CRC_INIT ^ f[3]] ^ f[4]] == f[5]);
+    //Same operations as convertTemperature/convertHumidity so that every kernel gives the same floats
+    temperatureC[i] = 175.0f * (float)(((uint16_t)f[0] << 8) | f[1]) / 65535.0f - 45.0f;
+    humidity[i] = 100.0f * (float)(((uint16_t)f[3] << 8) | f[4]) / 65535.0f;
+    valid[i] = ok;
+    n += ok;
+  }
+  return n;
+}
+
+#ifdef SHT3X_BATCH_X86
+/**
+ * Put 16-bit lanes 0,3,6,1,4,7,2,5 back in order 0..7 (multiplying by 3 mod 8 is its own inverse): swap lanes 1,3
+ * and 5,7 inside the halves, then take lanes 2 and 6 from a copy with dwords 1 and 3 swapped.
+ */
+__attribute__((target("sse2")))
+static inline __m128i frameOrder(__m128i v)
+{
+  const __m128i lanes26 = _mm_setr_epi16(0,0,-1,0,0,0,-1,0);
+  __m128i x = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v,_MM_SHUFFLE(1,2,3,0)),_MM_SHUFFLE(1,2,3,0));
+  __m128i y = _mm_shuffle_epi32(x,_MM_SHUFFLE(1,2,3,0));
+  return _mm_or_si128(_mm_andnot_si128(lanes26,x),_mm_and_si128(lanes26,y));
+}
+
+/**
+ * Little-endian 16-bit words 0, 1 and 2 of 8 consecutive frames, lane k from frame k, from three 16-byte loads.
+ * Word j of the 48 bytes is lane j mod 8 of a load, so masked blends collect words 3k+r of the 8 frames in the
+ * lane order 0,3,6,1,4,7,2,5, rotated by r lanes.
+ */
+__attribute__((target("sse2")))
+static inline void load8Frames(const uint8_t *p,__m128i &a,__m128i &b,__m128i &c)
+{
+  const __m128i lanes036 = _mm_setr_epi16(-1,0,0,-1,0,0,-1,0);
+  const __m128i lanes147 = _mm_setr_epi16(0,-1,0,0,-1,0,0,-1);
+  const __m128i lanes25 = _mm_setr_epi16(0,0,-1,0,0,-1,0,0);
+  __m128i v0 = _mm_loadu_si128((const __m128i *)p);
+  __m128i v1 = _mm_loadu_si128((const __m128i *)(p + 16));
+  __m128i v2 = _mm_loadu_si128((const __m128i *)(p + 32));
+  a = _mm_or_si128(_mm_or_si128(_mm_and_si128(v0,lanes036),_mm_and_si128(v1,lanes147)),_mm_and_si128(v2,lanes25));
+  b = _mm_or_si128(_mm_or_si128(_mm_and_si128(v0,lanes147),_mm_and_si128(v1,lanes25)),_mm_and_si128(v2,lanes036));
+  c = _mm_or_si128(_mm_or_si128(_mm_and_si128(v0,lanes25),_mm_and_si128(v1,lanes036)),_mm_and_si128(v2,lanes147));
+  a = frameOrder(a);
+  b = frameOrder(_mm_or_si128(_mm_srli_si128(b,2),_mm_slli_si128(b,14)));
+  c = frameOrder(_mm_or_si128(_mm_srli_si128(c,4),_mm_slli_si128(c,12)));
+}
+
+/**
+ * CRC of 16 byte pairs at once, one per byte lane. The CRC is affine in the two bytes, crc = tab[tab[0xFF]] ^
+ * tab[tab[MSB]] ^ tab[LSB], so it is the XOR of one column per set bit: 16 independent terms instead of a chain
+ * of 16 dependent shift steps. columns holds the 16 columns broadcast, see convertSSE2.
+ */
+__attribute__((target("sse2")))
+static inline __m128i crcSSE2(__m128i msb,__m128i lsb,const __m128i *columns)
+{
+  const __m128i zero = _mm_setzero_si128();
+  __m128i crcMsb = _mm_set1_epi8((char)0x81);
+  __m128i crcLsb = zero;
+  //Bit 7 down to 0: the sign bit of each byte is the current bit, adding a byte to itself brings the next one
+  for(uint8_t j = 0; j < 8; j++){
+    crcMsb = _mm_xor_si128(crcMsb,_mm_and_si128(_mm_cmplt_epi8(msb,zero),columns[j]));
+    crcLsb = _mm_xor_si128(crcLsb,_mm_and_si128(_mm_cmplt_epi8(lsb,zero),columns[8 + j]));
+    msb = _mm_add_epi8(msb,msb);
+    lsb = _mm_add_epi8(lsb,lsb);
+  }
+  return _mm_xor_si128(crcMsb,crcLsb);
+}
+
+__attribute__((target("sse2")))
+static inline __m128 toFloatSSE2(__m128i words,__m128 scale,__m128 offset)
+{
+  __m128 value = _mm_cvtepi32_ps(words);
+  return _mm_sub_ps(_mm_div_ps(_mm_mul_ps(scale,value),_mm_set1_ps(65535.0f)),offset);
+}
+
+__attribute__((target("sse2")))
+static size_t convertSSE2(const uint8_t *frames,size_t count,float *temperatureC,float *humidity,uint8_t *valid)
+{
+  //tab[tab[1 << bit]] then tab[1 << bit], bit 7 down to 0
+  static const uint8_t column[16] = {0x23,0x89,0xDC,0x6E,0x37,0x83,0xD9,0xF4,0x7A,0x3D,0x86,0x43,0xB9,0xC4,0x62,0x31};
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i lowByte = _mm_set1_epi16(0x00FF);
+  __m128i columns[16];
+  size_t n = 0;
+  size_t i = 0;
+  for(uint8_t j = 0; j < 16; j++){
+    columns[j] = _mm_set1_epi8((char)column[j]);
+  }
+  for(; i + 8 <= count; i += 8){
+    const uint8_t *f = frames + i * SHT3X_FRAME_SIZE;
+    __m128i a,b,c;
+    //a: temperature MSB | LSB << 8, b: temperature CRC | humidity MSB << 8, c: humidity LSB | humidity CRC << 8
+    load8Frames(f,a,b,c);
+    __m128i tWords = _mm_or_si128(_mm_slli_epi16(a,8),_mm_srli_epi16(a,8));
+    __m128i hWords = _mm_or_si128(_mm_andnot_si128(lowByte,b),_mm_and_si128(c,lowByte));
+    //Temperature in the low 8 byte lanes, humidity in the high 8, so one CRC pass checks both words of 8 frames
+    __m128i msb = _mm_packus_epi16(_mm_srli_epi16(tWords,8),_mm_srli_epi16(hWords,8));
+    __m128i lsb = _mm_packus_epi16(_mm_and_si128(tWords,lowByte),_mm_and_si128(hWords,lowByte));
+    __m128i crc = _mm_packus_epi16(_mm_and_si128(b,lowByte),_mm_srli_epi16(c,8));
+    __m128i ok = _mm_cmpeq_epi8(crcSSE2(msb,lsb,columns),crc);
+    ok = _mm_and_si128(ok,_mm_srli_si128(ok,8));
+    ok = _mm_and_si128(ok,_mm_set1_epi8(1));
+    _mm_storel_epi64((__m128i *)(valid + i),ok);
+    //The upper 8 lanes are 0, psadbw adds the 8 flags without a popcount (SSE2 has no popcnt)
+    n += _mm_cvtsi128_si32(_mm_sad_epu8(ok,zero));
+    _mm_storeu_ps(temperatureC + i,toFloatSSE2(_mm_unpacklo_epi16(tWords,zero),_mm_set1_ps(175.0f),_mm_set1_ps(45.0f)));
+    _mm_storeu_ps(temperatureC + i + 4,toFloatSSE2(_mm_unpackhi_epi16(tWords,zero),_mm_set1_ps(175.0f),_mm_set1_ps(45.0f)));
+    _mm_storeu_ps(humidity + i,toFloatSSE2(_mm_unpacklo_epi16(hWords,zero),_mm_set1_ps(100.0f),_mm_setzero_ps()));
+    _mm_storeu_ps(humidity + i + 4,toFloatSSE2(_mm_unpackhi_epi16(hWords,zero),_mm_set1_ps(100.0f),_mm_setzero_ps()));
+  }
+  return n + convertScalar(frames + i * SHT3X_FRAME_SIZE,count - i,temperatureC + i,humidity + i,valid + i);
+}
+
+/**
+ * CRC of 8 words (low 16 bits of each 32-bit lane) by nibble lookups: the CRC is affine in the two bytes,
+ * crc = tab[tab[MSB]] ^ tab[LSB] ^ tab[tab[0xFF]], and each term splits into a low and a high nibble table.
+ */
+__attribute__((target("avx2")))
+static inline __m256i crcAVX2(__m256i words)
+{
+  const __m256i lsbLow = _mm256_setr_epi8(0x00,0x31,0x62,0x53,0xC4,0xF5,0xA6,0x97,0xB9,0x88,0xDB,0xEA,0x7D,0x4C,0x1F,0x2E,
+                                          0x00,0x31,0x62,0x53,0xC4,0xF5,0xA6,0x97,0xB9,0x88,0xDB,0xEA,0x7D,0x4C,0x1F,0x2E);
+  const __m256i lsbHigh = _mm256_setr_epi8(0x00,0x43,0x86,0xC5,0x3D,0x7E,0xBB,0xF8,0x7A,0x39,0xFC,0xBF,0x47,0x04,0xC1,0x82,
+                                           0x00,0x43,0x86,0xC5,0x3D,0x7E,0xBB,0xF8,0x7A,0x39,0xFC,0xBF,0x47,0x04,0xC1,0x82);
+  const __m256i msbLow = _mm256_setr_epi8(0x00,0xF4,0xD9,0x2D,0x83,0x77,0x5A,0xAE,0x37,0xC3,0xEE,0x1A,0xB4,0x40,0x6D,0x99,
+                                          0x00,0xF4,0xD9,0x2D,0x83,0x77,0x5A,0xAE,0x37,0xC3,0xEE,0x1A,0xB4,0x40,0x6D,0x99);
+  const __m256i msbHigh = _mm256_setr_epi8(0x00,0x6E,0xDC,0xB2,0x89,0xE7,0x55,0x3B,0x23,0x4D,0xFF,0x91,0xAA,0xC4,0x76,0x18,
+                                           0x00,0x6E,0xDC,0xB2,0x89,0xE7,0x55,0x3B,0x23,0x4D,0xFF,0x91,0xAA,0xC4,0x76,0x18);
+  const __m256i nibble = _mm256_set1_epi32(0x0F);
+  //Index bytes other than the lowest are 0 and every table has entry 0 = 0, so the upper bytes stay 0
+  __m256i crc = _mm256_set1_epi32(0x81);
+  crc = _mm256_xor_si256(crc,_mm256_shuffle_epi8(lsbLow,_mm256_and_si256(words,nibble)));
+  crc = _mm256_xor_si256(crc,_mm256_shuffle_epi8(lsbHigh,_mm256_and_si256(_mm256_srli_epi32(words,4),nibble)));
+  crc = _mm256_xor_si256(crc,_mm256_shuffle_epi8(msbLow,_mm256_and_si256(_mm256_srli_epi32(words,8),nibble)));
+  crc = _mm256_xor_si256(crc,_mm256_shuffle_epi8(msbHigh,_mm256_and_si256(_mm256_srli_epi32(words,12),nibble)));
+  return crc;
+}
+
+__attribute__((target("avx2")))
+static inline __m256 toFloatAVX2(__m256i words,__m256 scale,__m256 offset)
+{
+  __m256 value = _mm256_cvtepi32_ps(words);
+  return _mm256_sub_ps(_mm256_div_ps(_mm256_mul_ps(scale,value),_mm256_set1_ps(65535.0f)),offset);
+}
+
+__attribute__((target("avx2")))
+static size_t convertAVX2(const uint8_t *frames,size_t count,float *temperatureC,float *humidity,uint8_t *valid)
+{
+  const __m256i offsets = _mm256_setr_epi32(0,6,12,18,24,30,36,42);
+  //Byte moves inside each 32-bit lane, 0x80 clears the byte
+  const __m256i tWordBytes = _mm256_setr_epi8(1,0,-128,-128,5,4,-128,-128,9,8,-128,-128,13,12,-128,-128,
+                                              1,0,-128,-128,5,4,-128,-128,9,8,-128,-128,13,12,-128,-128);
+  const __m256i tCrcBytes = _mm256_setr_epi8(2,-128,-128,-128,6,-128,-128,-128,10,-128,-128,-128,14,-128,-128,-128,
+                                             2,-128,-128,-128,6,-128,-128,-128,10,-128,-128,-128,14,-128,-128,-128);
+  const __m256i hWordBytes = _mm256_setr_epi8(2,1,-128,-128,6,5,-128,-128,10,9,-128,-128,14,13,-128,-128,
+                                              2,1,-128,-128,6,5,-128,-128,10,9,-128,-128,14,13,-128,-128);
+  const __m256i hCrcBytes = _mm256_setr_epi8(3,-128,-128,-128,7,-128,-128,-128,11,-128,-128,-128,15,-128,-128,-128,
+                                             3,-128,-128,-128,7,-128,-128,-128,11,-128,-128,-128,15,-128,-128,-128);
+  size_t n = 0;
+  size_t i = 0;
+  for(; i + 8 <= count; i += 8){
+    const uint8_t *f = frames + i * SHT3X_FRAME_SIZE;
+    //Both gathers stay inside the frames: bytes 0-3 and 2-5 of each
+    __m256i a = _mm256_i32gather_epi32((const int *)f,offsets,1);
+    __m256i b = _mm256_i32gather_epi32((const int *)(f + 2),offsets,1);
+    __m256i tWords = _mm256_shuffle_epi8(a,tWordBytes);
+    __m256i hWords = _mm256_shuffle_epi8(b,hWordBytes);
+    __m256i ok = _mm256_and_si256(_mm256_cmpeq_epi32(crcAVX2(tWords),_mm256_shuffle_epi8(a,tCrcBytes)),
+                                  _mm256_cmpeq_epi32(crcAVX2(hWords),_mm256_shuffle_epi8(b,hCrcBytes)));
+    uint32_t mask = _mm256_movemask_ps(_mm256_castsi256_ps(ok));
+    //Spread the 8 mask bits into 8 bytes of 0/1
+    uint64_t flags = (((mask & 0x0F) * 0x204081ULL) & 0x01010101ULL) | ((((mask >> 4) * 0x204081ULL) & 0x01010101ULL) << 32);
+    memcpy(valid + i,&flags,8);
+    n += __builtin_popcount(mask);
+    _mm256_storeu_ps(temperatureC + i,toFloatAVX2(tWords,_mm256_set1_ps(175.0f),_mm256_set1_ps(45.0f)));
+    _mm256_storeu_ps(humidity + i,toFloatAVX2(hWords,_mm256_set1_ps(100.0f),_mm256_setzero_ps()));
+  }
+  return n + convertScalar(frames + i * SHT3X_FRAME_SIZE,count - i,temperatureC + i,humidity + i,valid + i);
+}
+#endif
+
+#ifdef SHT3X_BATCH_NEON
+static inline uint8x16_t crcNEON(uint8x16_t msb,uint8x16_t lsb)
+{
+  const uint8x16_t polynomial = vdupq_n_u8(CRC_POLYNOMIAL);
+  const uint8x16_t top = vdupq_n_u8(0x80);
+  uint8x16_t crc = veorq_u8(vdupq_n_u8(CRC_INIT),msb);
+  for(uint8_t bit = 0; bit < 16; bit++){
+    if(bit == 8){
+      crc = veorq_u8(crc,lsb);
+    }
+    uint8x16_t mask = vtstq_u8(crc,top);
+    crc = veorq_u8(vshlq_n_u8(crc,1),vandq_u8(mask,polynomial));
+  }
+  return crc;
+}
+
+static inline void toFloatNEON(uint8x16_t msb,uint8x16_t lsb,float scale,float offset,float *out)
+{
+  const float32x4_t vScale = vdupq_n_f32(scale);
+  const float32x4_t vOffset = vdupq_n_f32(offset);
+  const float32x4_t vFull = vdupq_n_f32(65535.0f);
+  uint16x8_t words[2] = {vorrq_u16(vshll_n_u8(vget_low_u8(msb),8),vmovl_u8(vget_low_u8(lsb))),
+                         vorrq_u16(vshll_n_u8(vget_high_u8(msb),8),vmovl_u8(vget_high_u8(lsb)))};
+  for(uint8_t j = 0; j < 2; j++){
+    float32x4_t lo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(words[j])));
+    float32x4_t hi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(words[j])));
+    vst1q_f32(out + j * 8,vsubq_f32(vdivq_f32(vmulq_f32(vScale,lo),vFull),vOffset));
+    vst1q_f32(out + j * 8 + 4,vsubq_f32(vdivq_f32(vmulq_f32(vScale,hi),vFull),vOffset));
+  }
+}
+
+static size_t convertNEON(const uint8_t *frames,size_t count,float *temperatureC,float *humidity,uint8_t *valid)
+{
+  size_t n = 0;
+  size_t i = 0;
+  for(; i + 16 <= count; i += 16){
+    //vld3 splits 8 frames by stride 3 (frame f: temperature byte in lane 2f, humidity byte in lane 2f+1), vuzp splits them
+    uint8x16x3_t a = vld3q_u8(frames + i * SHT3X_FRAME_SIZE);
+    uint8x16x3_t b = vld3q_u8(frames + i * SHT3X_FRAME_SIZE + 48);
+    uint8x16x2_t msb = vuzpq_u8(a.val[0],b.val[0]);
+    uint8x16x2_t lsb = vuzpq_u8(a.val[1],b.val[1]);
+    uint8x16x2_t crc = vuzpq_u8(a.val[2],b.val[2]);
+    uint8x16_t tOk = vceqq_u8(crcNEON(msb.val[0],lsb.val[0]),crc.val[0]);
+    uint8x16_t hOk = vceqq_u8(crcNEON(msb.val[1],lsb.val[1]),crc.val[1]);
+    uint8x16_t flags = vandq_u8(vandq_u8(tOk,hOk),vdupq_n_u8(1));
+    vst1q_u8(valid + i,flags);
+    n += vaddvq_u8(flags);
+    toFloatNEON(msb.val[0],lsb.val[0],175.0f,45.0f,temperatureC + i);
+    toFloatNEON(msb.val[1],lsb.val[1],100.0f,0.0f,humidity + i);
+  }
+  return n + convertScalar(frames + i * SHT3X_FRAME_SIZE,count - i,temperatureC + i,humidity + i,valid + i);
+}
+#endif
+
+static DFRobot_SHT3x_Batch::eKernel_t bestKernel()
+{
+  if(DFRobot_SHT3x_Batch::isSupported(DFRobot_SHT3x_Batch::eKernelAVX2)){
+    return DFRobot_SHT3x_Batch::eKernelAVX2;
+  } else if(DFRobot_SHT3x_Batch::isSupported(DFRobot_SHT3x_Batch::eKernelSSE2)){
+    return DFRobot_SHT3x_Batch::eKernelSSE2;
+  } else if(DFRobot_SHT3x_Batch::isSupported(DFRobot_SHT3x_Batch::eKernelNEON)){
+    return DFRobot_SHT3x_Batch::eKernelNEON;
+  }
+  return DFRobot_SHT3x_Batch::eKernelScalar;
+}
+
+static DFRobot_SHT3x_Batch::eKernel_t currentKernel = bestKernel();
+
+bool DFRobot_SHT3x_Batch::isSupported(eKernel_t kernel)
+{
+  switch(kernel){
+    case eKernelScalar:
+      return true;
+#ifdef SHT3X_BATCH_X86
+    case eKernelSSE2:
+      //Also called by the static initializer of currentKernel, before the CPU model is known otherwise
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("sse2");
+    case eKernelAVX2:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2");
+#endif
+#ifdef SHT3X_BATCH_NEON
+    case eKernelNEON:
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+bool DFRobot_SHT3x_Batch::setKernel(eKernel_t kernel)
+{
+  if(!isSupported(kernel)){
+    return false;
+  }
+  currentKernel = kernel;
+  return true;
+}
+
+DFRobot_SHT3x_Batch::eKernel_t DFRobot_SHT3x_Batch::getKernel()
+{
+  return currentKernel;
+}
+
+size_t DFRobot_SHT3x_Batch::convertFrames(const uint8_t *frames,size_t count,float *temperatureC,float *humidity,uint8_t *valid)
+{
+  switch(currentKernel){
+#ifdef SHT3X_BATCH_X86
+    case eKernelSSE2:
+      return convertSSE2(frames,count,temperatureC,humidity,valid);
+    case eKernelAVX2:
+      return convertAVX2(frames,count,temperatureC,humidity,valid);
+#endif
+#ifdef SHT3X_BATCH_NEON
+    case eKernelNEON:
+      return convertNEON(frames,count,temperatureC,humidity,valid);
+#endif
+    default:
+      return convertScalar(frames,count,temperatureC,humidity,valid);
+  }
+}
+#endif
@@ -0,0 +1,80 @@
+/*!
+ * @file DFRobot_SHT3x_Batch.h
+ * @brief Define the infrastructure of the DFRobot_SHT3x_Batch class
+ * @details Batch conversion of raw SHT3x frames for Linux gateways: a contiguous buffer of 6-byte frames (temperature
+ * @n word, CRC, humidity word, CRC) is CRC checked and converted into °C and %RH arrays. The SSE2 and AVX2 (x86)
+ * @n kernels are chosen at run time from the CPU, with a scalar fallback; every kernel gives the same results
+ * @n as checkCrc, convertTemperature and convertHumidity of DFRobot_SHT3x, bit for bit.
+ * @n NEON is not delivered: aarch64 uses the scalar kernel. The NEON kernel has never been run (no aarch64 machine
+ * @n was at hand), it is only built with SHT3X_BATCH_ENABLE_NEON defined, for whoever checks it with batchBenchmark.
+ * @n Host only: the class is compiled on Linux outside of Arduino and is empty on the boards.
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef DFROBOT_SHT3X_BATCH_H
+#define DFROBOT_SHT3X_BATCH_H
+#if defined(__linux__) && !defined(ARDUINO)
+#include <stdint.h>
+#include <stddef.h>
+
+#define SHT3X_FRAME_SIZE    6   ///< Bytes of one raw frame: temperature MSB, LSB, CRC, humidity MSB, LSB, CRC
+
+class DFRobot_SHT3x_Batch
+{
+public:
+
+  /**
+   * @enum eKernel_t
+   * @brief Implementation used by convertFrames
+   */
+  typedef enum{
+    eKernelScalar = 0,/**<Portable C++, one frame at a time*/
+    eKernelSSE2 = 1,/**<x86 SSE2, 8 frames at a time*/
+    eKernelAVX2 = 2,/**<x86 AVX2, 8 frames at a time*/
+    eKernelNEON = 3,/**<aarch64 NEON, 16 frames at a time, not delivered: unverified, only with SHT3X_BATCH_ENABLE_NEON*/
+  } eKernel_t;
+
+public:
+
+  /**
+   * @fn convertFrames
+   * @brief CRC check and convert a buffer of frames.
+   * @param frames  count * SHT3X_FRAME_SIZE bytes, as read from the sensors.
+   * @param count  Number of frames.
+   * @param temperatureC  Receive count temperatures (°C), written for the frames that failed the CRC check too.
+   * @param humidity  Receive count relative humidities (%RH), written for the frames that failed the CRC check too.
+   * @param valid  Receive count flags, 1 when both CRC of the frame are right, 0 otherwise.
+   * @return Return the number of frames that passed the CRC check
+   */
+  static size_t convertFrames(const uint8_t *frames,size_t count,float *temperatureC,float *humidity,uint8_t *valid);
+
+  /**
+   * @fn getKernel
+   * @brief Get the kernel convertFrames uses, the fastest one the CPU supports unless setKernel was called.
+   * @return Return the kernel with the type eKernel_t
+   */
+  static eKernel_t getKernel();
+
+  /**
+   * @fn setKernel
+   * @brief Force a kernel, e.g. to compare them.
+   * @param kernel  Kernel with the type eKernel_t.
+   * @return Return false when the CPU or the build does not support it, the kernel is then unchanged.
+   */
+  static bool setKernel(eKernel_t kernel);
+
+  /**
+   * @fn isSupported
+   * @brief Whether a kernel can run on this CPU with this build.
+   * @param kernel  Kernel with the type eKernel_t.
+   * @return Return true when supported
+   */
+  static bool isSupported(eKernel_t kernel);
+};
+#endif
+#endif
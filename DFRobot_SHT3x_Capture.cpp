@@ -0,0 +1,96 @@
+/*!
+ * @file DFRobot_SHT3x_Capture.cpp
+ * @brief Implementation of the recording transport of the DFRobot_SHT3x bus transfers
+ *
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include <DFRobot_SHT3x_Capture.h>
+
+DFRobot_SHT3x_Capture::DFRobot_SHT3x_Capture(Print &out,TwoWire *pWire)
+{
+  _pOut = &out;
+  _pWire = pWire;
+  _started = false;
+  _last = 0;
+  _records = 0;
+  _size = 0;
+}
+
+uint8_t DFRobot_SHT3x_Capture::write(uint8_t address,const uint8_t *pBuf,uint8_t size)
+{
+  uint32_t start = micros();
+  _pWire->beginTransmission(address);
+  for(uint8_t i = 0; i < size; i++){
+    _pWire->write(pBuf[i]);
+  }
+  uint8_t status = _pWire->endTransmission();
+  record(address,size,start,micros(),status,pBuf,size);
+  return status;
+}
+
+uint8_t DFRobot_SHT3x_Capture::read(uint8_t address,uint8_t *pBuf,uint8_t size)
+{
+  uint32_t start = micros();
+  uint8_t len = _pWire->requestFrom(address,(size_t)size);
+  for(uint8_t i = 0; i < size; i++){
+    pBuf[i] = _pWire->read();
+  }
+  record(address,SHT3X_CAPTURE_READ | size,start,micros(),len,pBuf,len < size ? len : size);
+  return len;
+}
+
+uint32_t DFRobot_SHT3x_Capture::getRecordCount()
+{
+  return _records;
+}
+
+uint32_t DFRobot_SHT3x_Capture::getSize()
+{
+  return _size;
+}
+
+void DFRobot_SHT3x_Capture::record(uint8_t address,uint8_t kind,uint32_t start,uint32_t end,uint8_t result,const uint8_t *pBuf,uint8_t size)
+{
+  uint8_t buf[SHT3X_CAPTURE_HEADER_SIZE + 12 + SHT3X_CAPTURE_MAX_SIZE];
+  uint8_t n = 0;
+  if(!_started){
+    buf[n++] = 'S';
+    buf[n++] = '3';
+    buf[n++] = 'X';
+    buf[n++] = 'C';
+    buf[n++] = SHT3X_CAPTURE_VERSION;
+    buf[n++] = address;
+    _last = start;
+    _started = true;
+  }
+  if(size > SHT3X_CAPTURE_MAX_SIZE){
+    size = SHT3X_CAPTURE_MAX_SIZE;
+  }
+  buf[n++] = kind;
+  n += putVarint(buf + n,start - _last);
+  n += putVarint(buf + n,end - start);
+  buf[n++] = result;
+  memcpy(buf + n,pBuf,size);
+  n += size;
+  _last = start;
+  _pOut->write(buf,n);
+  _records++;
+  _size += n;
+}
+
+uint8_t DFRobot_SHT3x_Capture::putVarint(uint8_t *p,uint32_t value)
+{
+  uint8_t n = 0;
+  while(value >= 0x80){
+    p[n++] = (value & 0x7F) | 0x80;
+    value >>= 7;
+  }
+  p[n++] = value;
+  return n;
+}
@@ -0,0 +1,95 @@
+/*!
+ * @file DFRobot_SHT3x_Capture.h
+ * @brief Define the infrastructure of the DFRobot_SHT3x_Capture class
+ * @details Recording transport: performs the transfers of a DFRobot_SHT3x on the real bus and logs every one of
+ * @n them, with its time, duration, result (ACK/NACK, bytes received) and bytes, as a compact binary record to any
+ * @n Print (an SD card File, or Serial piped into a file). DFRobot_SHT3x_Replay plays the file back on a Linux host.
+ * @n File layout: header "S3XC", version, chip address, then one record per transfer:
+ * @n   kind byte (bit 7 set for a read, bits 0-6 the size), time since the previous record (us, varint),
+ * @n   duration (us, varint), result byte (endTransmission status or bytes received), the bytes sent or received
+ * @n   (at most SHT3X_CAPTURE_MAX_SIZE).
+ * @n A command write takes about 8 bytes, a 6-byte measurement read about 12 bytes.
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef DFROBOT_SHT3X_CAPTURE_H
+#define DFROBOT_SHT3X_CAPTURE_H
+#include "Arduino.h"
+#include <Wire.h>
+#include "DFRobot_SHT3x_Transport.h"
+
+#define SHT3X_CAPTURE_VERSION     1     ///< Version of the capture file layout
+#define SHT3X_CAPTURE_HEADER_SIZE 6     ///< "S3XC", version, chip address
+#define SHT3X_CAPTURE_READ        0x80  ///< Kind bit of a read record
+#define SHT3X_CAPTURE_MAX_SIZE    16    ///< Most bytes a record holds, the driver never moves more than 6
+
+class DFRobot_SHT3x_Capture : public DFRobot_SHT3x_Transport
+{
+public:
+
+  /**
+   * @fn DFRobot_SHT3x_Capture
+   * @brief Construct the function
+   * @param out  Sink of the capture. A slow sink (a full Serial buffer) stretches the time between transfers.
+   * @param pWire  Bus the transfers are done on, Wire in default.
+   */
+  DFRobot_SHT3x_Capture(Print &out,TwoWire *pWire = &Wire);
+
+  /**
+   * @fn write
+   * @brief Send bytes to the chip and record the transfer, the file header is written before the first record.
+   * @return Return the endTransmission() status, 0 when the chip acknowledged
+   */
+  uint8_t write(uint8_t address,const uint8_t *pBuf,uint8_t size);
+
+  /**
+   * @fn read
+   * @brief Read bytes from the chip and record the transfer, the file header is written before the first record.
+   * @return Return the number of bytes the chip sent, 0 when it answered NACK
+   */
+  uint8_t read(uint8_t address,uint8_t *pBuf,uint8_t size);
+
+  /**
+   * @fn getRecordCount
+   * @brief Get the number of transfers recorded
+   * @return Return the number of records
+   */
+  uint32_t getRecordCount();
+
+  /**
+   * @fn getSize
+   * @brief Get the number of bytes written to the sink, header included
+   * @return Return the size of the capture
+   */
+  uint32_t getSize();
+
+private:
+
+  /**
+   * @fn record
+   * @brief Encode one record and hand it to the sink in a single write.
+   */
+  void record(uint8_t address,uint8_t kind,uint32_t start,uint32_t end,uint8_t result,const uint8_t *pBuf,uint8_t size);
+
+  /**
+   * @fn putVarint
+   * @brief Encode an unsigned value 7 bits per byte, low bits first.
+   * @return Return the number of bytes used, 1 to 5
+   */
+  static uint8_t putVarint(uint8_t *p,uint32_t value);
+
+private:
+
+  Print *_pOut;
+  TwoWire *_pWire;
+  bool _started;
+  uint32_t _last;
+  uint32_t _records;
+  uint32_t _size;
+};
+#endif
@@ -0,0 +1,98 @@
+/*!
+ * @file DFRobot_SHT3x_Deadband.cpp
+ * @brief Implementation of the report-by-exception filter of the DFRobot_SHT3x samples
+ * 
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include <DFRobot_SHT3x_Deadband.h>
+
+/**
+ * Raw word change for a change of delta over a span of the 65535 raw range, clamped to the raw range (a negative
+ * or NaN delta gives 0, converting an out of range float to uint16_t is undefined).
+ */
+static uint16_t rawDelta(float delta,float span)
+{
+  float raw = delta / span * 65535.0f + 0.5f;
+  if(!(raw > 0.0f)){
+    return 0;
+  }
+  if(raw >= 65535.0f){
+    return 65535;
+  }
+  return (uint16_t)raw;
+}
+
+DFRobot_SHT3x_Deadband::DFRobot_SHT3x_Deadband(uint32_t maxSilenceMs)
+{
+  memset(_absolute,0,sizeof(_absolute));
+  memset(_relative,0,sizeof(_relative));
+  _maxSilence = maxSilenceMs;
+  reset();
+}
+
+void DFRobot_SHT3x_Deadband::setTemperatureDeadbandC(float delta)
+{
+  setAbsoluteDeadband(eTemperature,rawDelta(delta,175.0f));
+}
+
+void DFRobot_SHT3x_Deadband::setHumidityDeadbandRH(float delta)
+{
+  setAbsoluteDeadband(eHumidity,rawDelta(delta,100.0f));
+}
+
+void DFRobot_SHT3x_Deadband::setAbsoluteDeadband(eChannel_t channel,uint16_t rawDelta)
+{
+  _absolute[channel] = rawDelta;
+}
+
+void DFRobot_SHT3x_Deadband::setRelativeDeadband(eChannel_t channel,uint16_t permille)
+{
+  _relative[channel] = permille;
+}
+
+void DFRobot_SHT3x_Deadband::setMaxSilence(uint32_t maxSilenceMs)
+{
+  _maxSilence = maxSilenceMs;
+}
+
+void DFRobot_SHT3x_Deadband::reset()
+{
+  memset(_reference,0,sizeof(_reference));
+  _lastReport = 0;
+  _valid = false;
+}
+
+bool DFRobot_SHT3x_Deadband::outside(eChannel_t channel,uint16_t raw)
+{
+  uint16_t reference = _reference[channel];
+  uint16_t change = (raw > reference) ? raw - reference : reference - raw;
+  uint32_t width = _absolute[channel];
+  if(_relative[channel]){
+    //above 1000 permille the width can pass the raw range
+    uint32_t relative = (uint32_t)reference * _relative[channel] / 1000;
+    if(relative > width){
+      width = relative;
+    }
+  }
+  return change > width;
+}
+
+bool DFRobot_SHT3x_Deadband::check(uint16_t rawTemperature,uint16_t rawHumidity,uint32_t now)
+{
+  if(_valid && !outside(eTemperature,rawTemperature) && !outside(eHumidity,rawHumidity)){
+    if((_maxSilence == 0) || (now - _lastReport < _maxSilence)){
+      return false;
+    }
+  }
+  _reference[eTemperature] = rawTemperature;
+  _reference[eHumidity] = rawHumidity;
+  _lastReport = now;
+  _valid = true;
+  return true;
+}
@@ -0,0 +1,113 @@
+/*!
+ * @file DFRobot_SHT3x_Deadband.h
+ * @brief Define the infrastructure of the DFRobot_SHT3x_Deadband class
+ * @details Report-by-exception filter of the SHT3x samples: a sample is reported only when one channel left its
+ * @n deadband around the last reported value, or when nothing was reported for the maximum silence time (heartbeat).
+ * @n The comparison works on the raw 16-bit words, so filtering a sample costs no float math.
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef DFROBOT_SHT3X_DEADBAND_H
+#define DFROBOT_SHT3X_DEADBAND_H
+#include "Arduino.h"
+
+class DFRobot_SHT3x_Deadband
+{
+public:
+
+  /**
+   * @enum eChannel_t
+   * @brief Select the measured quantity
+   */
+  typedef enum{
+    eTemperature = 0,/**<Temperature channel*/
+    eHumidity = 1,/**<Relative humidity channel*/
+  } eChannel_t;
+
+public:
+
+  /**
+   * @fn DFRobot_SHT3x_Deadband
+   * @brief Construct the function
+   * @param maxSilenceMs  Heartbeat, a sample is reported at least this often (ms), 0 disables the heartbeat.
+   */
+  DFRobot_SHT3x_Deadband(uint32_t maxSilenceMs = 0);
+
+  /**
+   * @fn setTemperatureDeadbandC
+   * @brief Set the absolute temperature deadband
+   * @param delta  Change needed to report a sample (°C), 0 reports every change.
+   */
+  void setTemperatureDeadbandC(float delta);
+
+  /**
+   * @fn setHumidityDeadbandRH
+   * @brief Set the absolute humidity deadband
+   * @param delta  Change needed to report a sample (%RH), 0 reports every change.
+   */
+  void setHumidityDeadbandRH(float delta);
+
+  /**
+   * @fn setAbsoluteDeadband
+   * @brief Set the absolute deadband of one channel in raw sensor units (°C * 65535 / 175, %RH * 65535 / 100)
+   * @param channel  eTemperature or eHumidity
+   * @param rawDelta  Change of the raw word needed to report a sample
+   */
+  void setAbsoluteDeadband(eChannel_t channel,uint16_t rawDelta);
+
+  /**
+   * @fn setRelativeDeadband
+   * @brief Set the relative deadband of one channel, in permille of the last reported raw word.
+   * @param channel  eTemperature or eHumidity
+   * @param permille  0 disables the relative deadband.
+   * @note The raw temperature word is proportional to (°C + 45), the raw humidity word to %RH.
+   * @n When both deadbands of a channel are set, the wider one applies.
+   */
+  void setRelativeDeadband(eChannel_t channel,uint16_t permille);
+
+  /**
+   * @fn setMaxSilence
+   * @brief Set the heartbeat
+   * @param maxSilenceMs  A sample is reported at least this often (ms), 0 disables the heartbeat.
+   */
+  void setMaxSilence(uint32_t maxSilenceMs);
+
+  /**
+   * @fn check
+   * @brief Decide whether a sample has to be reported, the reference values are updated when it is.
+   * @param rawTemperature  Raw temperature word from the sensor.
+   * @param rawHumidity  Raw humidity word from the sensor.
+   * @param now  Current time (ms), millis() in general.
+   * @return Return true when the sample has to be reported.
+   */
+  bool check(uint16_t rawTemperature,uint16_t rawHumidity,uint32_t now);
+
+  /**
+   * @fn reset
+   * @brief Forget the last reported sample, the next sample is always reported.
+   */
+  void reset();
+
+private:
+
+  /**
+   * @fn outside
+   * @brief Whether a raw word left the deadband of its channel around the reference.
+   */
+  bool outside(eChannel_t channel,uint16_t raw);
+
+private:
+
+  uint16_t _reference[2];
+  uint16_t _absolute[2];
+  uint16_t _relative[2];
+  uint32_t _maxSilence;
+  uint32_t _lastReport;
+  bool _valid;
+};
+#endif
@@ -0,0 +1,263 @@
+/*!
+ * @file DFRobot_SHT3x_Events.cpp
+ * @brief Implementation of the event-driven front end of the DFRobot_SHT3x class
+ * 
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include <DFRobot_SHT3x_Events.h>
+
+DFRobot_SHT3x_Events::DFRobot_SHT3x_Events(DFRobot_SHT3x &sht3x)
+{
+  _pSht3x = &sht3x;
+  _onSample = NULL;
+  _onAlert = NULL;
+  _onError = NULL;
+  _onReset = NULL;
+  _interval = 0;
+  _since = 0;
+  _started = 0;
+  _lastSample = 0;
+  _alertInterval = 0;
+  _alertSince = 0;
+  _repeatability = DFRobot_SHT3x::eRepeatability_High;
+  _state = eEventIdle;
+  _err = 0;
+  _failures = 0;
+  _autoRestore = false;
+  _alertPin = -1;
+  _alert = false;
+  _periodic = false;
+}
+
+void DFRobot_SHT3x_Events::onSample(sampleCallback_t callback)
+{
+  _onSample = callback;
+}
+
+void DFRobot_SHT3x_Events::onAlert(alertCallback_t callback)
+{
+  _onAlert = callback;
+}
+
+void DFRobot_SHT3x_Events::onError(errorCallback_t callback)
+{
+  _onError = callback;
+}
+
+void DFRobot_SHT3x_Events::onReset(resetCallback_t callback)
+{
+  _onReset = callback;
+}
+
+void DFRobot_SHT3x_Events::begin(uint32_t intervalMs,DFRobot_SHT3x::eRepeatability_t repeatability)
+{
+  start();
+  //A reset is only recognised by its flag, the one of the power-up must not be taken for it
+  _pSht3x->clearStatusRegister();
+  _interval = intervalMs;
+  _repeatability = repeatability;
+  _periodic = false;
+  //The first measurement is started by the next update()
+  _since = millis() - intervalMs;
+  _state = eEventWaiting;
+}
+
+bool DFRobot_SHT3x_Events::beginPeriodic(DFRobot_SHT3x::eMeasureFrequency_t measureFreq,DFRobot_SHT3x::eRepeatability_t repeatability)
+{
+  const uint16_t periodMs[5] = {2000,1000,500,250,100};
+  start();
+  //startPeriodicMode clears the reset flag
+  if(!_pSht3x->startPeriodicMode(measureFreq,repeatability)){
+    _pSht3x->setAutoRestore(_autoRestore);
+    _state = eEventIdle;
+    return false;
+  }
+  _interval = periodMs[measureFreq];
+  _repeatability = repeatability;
+  _periodic = true;
+  _since = millis();
+  _lastSample = _since;
+  _state = eEventWaiting;
+  return true;
+}
+
+void DFRobot_SHT3x_Events::stop()
+{
+  if(_state == eEventIdle){
+    return;
+  }
+  if(_periodic){
+    _pSht3x->stopPeriodicMode();
+  }
+  _pSht3x->setAutoRestore(_autoRestore);
+  _state = eEventIdle;
+}
+
+void DFRobot_SHT3x_Events::start()
+{
+  if(_state == eEventIdle){
+    _autoRestore = _pSht3x->getAutoRestore();
+    _pSht3x->setAutoRestore(false);
+  }
+  _failures = 0;
+  //Not idle from now on, so that a second begin() keeps the value saved by the first one
+  _state = eEventWaiting;
+}
+
+void DFRobot_SHT3x_Events::setAlertPin(int8_t pin)
+{
+  _alertPin = pin;
+  if(pin >= 0){
+    pinMode(pin,INPUT);
+  }
+}
+
+void DFRobot_SHT3x_Events::setAlertPolling(uint32_t intervalMs)
+{
+  _alertInterval = intervalMs;
+  _alertSince = millis();
+}
+
+DFRobot_SHT3x_Events::eEventState_t DFRobot_SHT3x_Events::update()
+{
+  const uint8_t waitMs[3] = {SHT3X_CONVERSION_TIME_H_MS,SHT3X_CONVERSION_TIME_M_MS,SHT3X_CONVERSION_TIME_L_MS};
+  DFRobot_SHT3x::sRHAndTemp_t data;
+  uint32_t now = millis();
+  switch(_state){
+    case eEventWaiting:
+      if(now - _since < _interval){
+        //Between two measurements the bus is free for the alert polling
+        if(_alertPin < 0 && _alertInterval && now - _alertSince >= _alertInterval){
+          _alertSince = now;
+          _pSht3x->startStatusRead();
+          _started = now;
+          _state = eEventReadingAlert;
+        }
+        break;
+      }
+      //Keep the cadence, but do not try to catch up after a long stall of the loop
+      _since += _interval;
+      if(now - _since >= _interval){
+        _since = now;
+      }
+      if(_periodic){
+        data = _pSht3x->readTemperatureAndHumidity();
+        handleResult(data,now);
+      } else {
+        _pSht3x->startMeasurement(_repeatability);
+        _started = now;
+        _state = eEventConverting;
+      }
+      break;
+    case eEventConverting:
+      if(now - _started >= waitMs[_repeatability]){
+        _pSht3x->readMeasurement(data);
+        _state = eEventWaiting;
+        handleResult(data,now);
+      }
+      break;
+    case eEventCheckingReset:
+      //Leave the chip the command gap before reading the status
+      if(now != _started){
+        _state = eEventWaiting;
+        handleStatus();
+      }
+      break;
+    case eEventReadingAlert:
+      if(now != _started){
+        _state = eEventWaiting;
+        handleAlertStatus();
+      }
+      break;
+    default:
+      break;
+  }
+  if(_alertPin >= 0){
+    setAlert(digitalRead(_alertPin) == HIGH);
+  }
+  return _state;
+}
+
+DFRobot_SHT3x_Events::eEventState_t DFRobot_SHT3x_Events::getState()
+{
+  return _state;
+}
+
+void DFRobot_SHT3x_Events::handleResult(const DFRobot_SHT3x::sRHAndTemp_t &data,uint32_t now)
+{
+  if(data.ERR == 0){
+    _failures = 0;
+    _lastSample = now;
+    if(_onSample){
+      _onSample(data);
+    }
+    return;
+  }
+  if(_periodic && data.ERR == ERR_NOT_READY){
+    //A fetch just before the new sample is answered NACK: try again soon, only two periods without a sample are an error
+    if(now - _lastSample <= 2 * _interval){
+      _since = now - _interval + SHT3X_EVENTS_FETCH_RETRY_MS;
+      return;
+    }
+    _lastSample = now;
+    startResetCheck(data.ERR,now);
+    return;
+  }
+  //A CRC error or a run of failed single measurements hints at a reset
+  if(_failures < 0xFF){
+    _failures++;
+  }
+  if(data.ERR != ERR_NOT_READY || _failures >= SHT3X_EVENTS_NACK_LIMIT){
+    startResetCheck(data.ERR,now);
+  } else if(_onError){
+    _onError(data.ERR);
+  }
+}
+
+void DFRobot_SHT3x_Events::startResetCheck(int err,uint32_t now)
+{
+  _failures = 0;
+  _err = err;
+  _pSht3x->startStatusRead();
+  _started = now;
+  _state = eEventCheckingReset;
+}
+
+void DFRobot_SHT3x_Events::handleStatus()
+{
+  DFRobot_SHT3x::sStatusRegister_t status;
+  if(_pSht3x->readStatusResult(status) == 0 && status.systemResetDeteced){
+    _pSht3x->restoreConfig();
+    if(_onReset){
+      _onReset();
+    }
+  } else if(_onError){
+    _onError(_err);
+  }
+}
+
+void DFRobot_SHT3x_Events::handleAlertStatus()
+{
+  DFRobot_SHT3x::sStatusRegister_t status;
+  //A NACK reads as 0xFFFF, both alert bits would look set
+  if(_pSht3x->readStatusResult(status) != 0){
+    return;
+  }
+  setAlert(status.humidityAlert || status.temperatureAlert);
+}
+
+void DFRobot_SHT3x_Events::setAlert(bool alert)
+{
+  if(alert != _alert){
+    _alert = alert;
+    if(_onAlert){
+      _onAlert(alert);
+    }
+  }
+}
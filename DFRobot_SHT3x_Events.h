@@ -0,0 +1,213 @@
+/*!
+ * @file DFRobot_SHT3x_Events.h
+ * @brief Define the infrastructure of the DFRobot_SHT3x_Events class
+ * @details Event-driven front end of the driver: register onSample, onAlert, onError and onReset callbacks and call
+ * @n update() from loop(). A single measurement is started by one update() and read by a later one once the
+ * @n conversion time has passed, so update() never waits for a conversion and several sensors or other peripherals
+ * @n can share one loop. The status reads of the alert polling and of the reset check are sent by one update() and
+ * @n read by the next one too. Each bus access still costs the 1ms command gap of the driver.
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef DFROBOT_SHT3X_EVENTS_H
+#define DFROBOT_SHT3X_EVENTS_H
+#include "DFRobot_SHT3x.h"
+
+#define SHT3X_EVENTS_NACK_LIMIT       2    ///< Single measurement mode: failed reads in a row, NACKs included, before the reset check
+#define SHT3X_EVENTS_FETCH_RETRY_MS   10   ///< Cycle measurement mode: time before a fetch answered NACK is tried again (ms)
+
+class DFRobot_SHT3x_Events
+{
+public:
+
+  /**
+   * @enum eEventState_t
+   * @brief State of the measurement state machine
+   */
+  typedef enum{
+    eEventIdle = 0,/**<Not started or stopped*/
+    eEventWaiting = 1,/**<Waiting for the next measurement*/
+    eEventConverting = 2,/**<Single measurement started, waiting for the conversion*/
+    eEventCheckingReset = 3,/**<Status read sent after failed reads, waiting to read it*/
+    eEventReadingAlert = 4,/**<Status read sent by the alert polling, waiting to read it*/
+  } eEventState_t;
+
+  /**
+   * @brief Called with every sample that passed the CRC check
+   */
+  typedef void (*sampleCallback_t)(const DFRobot_SHT3x::sRHAndTemp_t &data);
+
+  /**
+   * @brief Called when the alert state changes, alert is true while a temperature or humidity limit is exceeded
+   */
+  typedef void (*alertCallback_t)(bool alert);
+
+  /**
+   * @brief Called when a read failed and the chip was not reset, err is the ERR of the failed read
+   */
+  typedef void (*errorCallback_t)(int err);
+
+  /**
+   * @brief Called when the chip was found reset, the configuration has already been restored
+   */
+  typedef void (*resetCallback_t)(void);
+
+public:
+
+  /**
+   * @fn DFRobot_SHT3x_Events
+   * @brief Construct the function
+   * @param sht3x  Driver of the sensor, begin() must have succeeded before begin() of this class is called.
+   */
+  DFRobot_SHT3x_Events(DFRobot_SHT3x &sht3x);
+
+  /**
+   * @fn onSample
+   * @brief Register the sample callback, NULL to remove it.
+   */
+  void onSample(sampleCallback_t callback);
+
+  /**
+   * @fn onAlert
+   * @brief Register the alert callback, NULL to remove it. Alerts are only decoded after setAlertPin() or setAlertPolling().
+   */
+  void onAlert(alertCallback_t callback);
+
+  /**
+   * @fn onError
+   * @brief Register the error callback, NULL to remove it.
+   */
+  void onError(errorCallback_t callback);
+
+  /**
+   * @fn onReset
+   * @brief Register the reset callback, NULL to remove it.
+   */
+  void onReset(resetCallback_t callback);
+
+  /**
+   * @fn begin
+   * @brief Take a single measurement every intervalMs. The status register is cleared first, then the automatic
+   * @n restore of the driver is turned off until stop(): update() checks for a reset itself, so that it can call onReset,
+   * @n after a CRC error or SHT3X_EVENTS_NACK_LIMIT failed reads in a row. The check sends the status read in one
+   * @n update() and reads it in the next one, onError runs when no reset is found.
+   * @param intervalMs  Time between two measurements (ms).
+   * @param repeatability  Repeatability of each measurement with the type eRepeatability_t, eRepeatability_High in default.
+   */
+  void begin(uint32_t intervalMs,DFRobot_SHT3x::eRepeatability_t repeatability = DFRobot_SHT3x::eRepeatability_High);
+
+  /**
+   * @fn beginPeriodic
+   * @brief Enter cycle measurement mode and fetch one sample per measurement period. A fetch answered NACK (it came
+   * @n just before the new sample) is tried again SHT3X_EVENTS_FETCH_RETRY_MS later and is not an error: the reset
+   * @n check, then onError, only follow a CRC error or two measurement periods without a sample.
+   * @n The automatic restore is handled as in begin().
+   * @param measureFreq  Measurement frequency with the type eMeasureFrequency_t.
+   * @param repeatability  Repeatability with the type eRepeatability_t, eRepeatability_High in default.
+   * @return Return true when the cycle measurement mode was entered.
+   */
+  bool beginPeriodic(DFRobot_SHT3x::eMeasureFrequency_t measureFreq,DFRobot_SHT3x::eRepeatability_t repeatability = DFRobot_SHT3x::eRepeatability_High);
+
+  /**
+   * @fn stop
+   * @brief Stop measuring, the cycle measurement mode is left if it was entered by beginPeriodic() and the automatic
+   * @n restore of the driver is set back to its value before begin().
+   */
+  void stop();
+
+  /**
+   * @fn setAlertPin
+   * @brief Decode the alert from the ALERT pin, no bus access is needed.
+   * @param pin  MCU pin wired to ALERT, -1 to stop using it.
+   */
+  void setAlertPin(int8_t pin);
+
+  /**
+   * @fn setAlertPolling
+   * @brief Decode the alert from the status register when the ALERT pin is not wired. The status is only read between
+   * @n two measurements, sent by one update() and read by the next one; a read that fails its CRC is dropped.
+   * @param intervalMs  Time between two status reads (ms), 0 (in default) disables the polling.
+   */
+  void setAlertPolling(uint32_t intervalMs);
+
+  /**
+   * @fn update
+   * @brief Advance the state machines and run the callbacks, call it from loop() as often as possible.
+   * @n It never waits for a conversion or a status read, only on the 1ms command gap of a bus access.
+   * @return Return the state after the update.
+   */
+  eEventState_t update();
+
+  /**
+   * @fn getState
+   * @brief Get the state without advancing it.
+   * @return Return the state with the type eEventState_t
+   */
+  eEventState_t getState();
+
+private:
+
+  /**
+   * @fn start
+   * @brief Turn the automatic restore of the driver off, keeping its value for stop().
+   */
+  void start();
+
+  /**
+   * @fn handleResult
+   * @brief Run onSample for a good read. For a failed one, start the reset check or run onError.
+   */
+  void handleResult(const DFRobot_SHT3x::sRHAndTemp_t &data,uint32_t now);
+
+  /**
+   * @fn startResetCheck
+   * @brief Send the status read of the reset check, it is read by a later update().
+   */
+  void startResetCheck(int err,uint32_t now);
+
+  /**
+   * @fn handleStatus
+   * @brief Read the status of the reset check, restore the configuration and run onReset, or run onError.
+   */
+  void handleStatus();
+
+  /**
+   * @fn handleAlertStatus
+   * @brief Read the status of the alert polling, a read that failed its CRC tells nothing about the alert.
+   */
+  void handleAlertStatus();
+
+  /**
+   * @fn setAlert
+   * @brief Run onAlert when the alert changed.
+   */
+  void setAlert(bool alert);
+
+private:
+
+  DFRobot_SHT3x *_pSht3x;
+  sampleCallback_t _onSample;
+  alertCallback_t _onAlert;
+  errorCallback_t _onError;
+  resetCallback_t _onReset;
+  uint32_t _interval;
+  uint32_t _since;
+  uint32_t _started;
+  uint32_t _lastSample;
+  uint32_t _alertInterval;
+  uint32_t _alertSince;
+  DFRobot_SHT3x::eRepeatability_t _repeatability;
+  eEventState_t _state;
+  int _err;
+  uint8_t _failures;
+  bool _autoRestore;
+  int8_t _alertPin;
+  bool _alert;
+  bool _periodic;
+};
+#endif
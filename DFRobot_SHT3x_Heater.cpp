@@ -0,0 +1,111 @@
+/*!
+ * @file DFRobot_SHT3x_Heater.cpp
+ * @brief Implementation of the non-blocking heater duty-cycle controller of the DFRobot_SHT3x class
+ * 
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include <DFRobot_SHT3x_Heater.h>
+
+DFRobot_SHT3x_Heater::DFRobot_SHT3x_Heater(DFRobot_SHT3x &sht3x)
+{
+  _pSht3x = &sht3x;
+  _onTime = 0;
+  _offTime = 0;
+  _coolDown = 10000;
+  _since = 0;
+  _pulses = 0;
+  _done = 0;
+  _state = eHeaterIdle;
+  _running = false;
+}
+
+void DFRobot_SHT3x_Heater::begin(uint32_t onTimeMs,uint32_t offTimeMs,uint8_t maxDutyPercent)
+{
+  uint32_t minOffTime;
+  if(maxDutyPercent == 0){
+    maxDutyPercent = 1;
+  } else if(maxDutyPercent > 100){
+    maxDutyPercent = 100;
+  }
+  //on / (on + off) <= duty  =>  off >= on * (100 - duty) / duty
+  minOffTime = onTimeMs / maxDutyPercent * (100 - maxDutyPercent) + onTimeMs % maxDutyPercent * (100 - maxDutyPercent) / maxDutyPercent;
+  _onTime = onTimeMs;
+  _offTime = (offTimeMs > minOffTime) ? offTimeMs : minOffTime;
+}
+
+void DFRobot_SHT3x_Heater::setCoolDown(uint32_t coolDownMs)
+{
+  _coolDown = coolDownMs;
+}
+
+void DFRobot_SHT3x_Heater::start(uint16_t pulses)
+{
+  _pulses = pulses;
+  _done = 0;
+  _running = true;
+}
+
+void DFRobot_SHT3x_Heater::stop()
+{
+  _running = false;
+  if(_state == eHeaterOn){
+    switchHeater(false,millis());
+  }
+}
+
+void DFRobot_SHT3x_Heater::switchHeater(bool on,uint32_t now)
+{
+  if(on){
+    _pSht3x->heaterEnable(false);
+    _state = eHeaterOn;
+  } else {
+    _pSht3x->heaterDisable(false);
+    _state = eHeaterCooling;
+  }
+  _since = now;
+}
+
+DFRobot_SHT3x_Heater::eHeaterState_t DFRobot_SHT3x_Heater::update()
+{
+  uint32_t now = millis();
+  uint32_t elapsed = now - _since;
+  bool pending = _running && (_pulses == 0 || _done < _pulses);
+  switch(_state){
+    case eHeaterOn:
+      if(elapsed >= _onTime){
+        _done++;
+        switchHeater(false,now);
+      }
+      break;
+    case eHeaterCooling:
+      if(pending && elapsed >= _offTime){
+        switchHeater(true,now);
+      } else if(!pending && elapsed >= _coolDown){
+        _running = false;
+        _state = eHeaterIdle;
+      }
+      break;
+    default:
+      if(pending){
+        switchHeater(true,now);
+      }
+      break;
+  }
+  return _state;
+}
+
+DFRobot_SHT3x_Heater::eHeaterState_t DFRobot_SHT3x_Heater::getState()
+{
+  return _state;
+}
+
+bool DFRobot_SHT3x_Heater::isSampleValid()
+{
+  return _state == eHeaterIdle;
+}
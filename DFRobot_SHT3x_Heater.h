@@ -0,0 +1,118 @@
+/*!
+ * @file DFRobot_SHT3x_Heater.h
+ * @brief Define the infrastructure of the DFRobot_SHT3x_Heater class
+ * @details Non-blocking heater duty-cycle controller, e.g. to clear condensation: the heater is pulsed with the given
+ * @n on-time and off-time, never above the maximum duty cycle, by calling update() from loop(). The heater commands are
+ * @n sent without the status read-back, so update() never waits on the sensor; a switch only takes the 1 ms gap the
+ * @n driver keeps before every command. While the heater is on and during the cool-down after it was switched off,
+ * @n the readings are wrong and isSampleValid() returns false.
+ * @n In cycle measurement mode the heater command goes to the running cycle without a break, which the chip takes
+ * @n (the datasheet only recommends a break) and the measurement keeps running.
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef DFROBOT_SHT3X_HEATER_H
+#define DFROBOT_SHT3X_HEATER_H
+#include "DFRobot_SHT3x.h"
+
+class DFRobot_SHT3x_Heater
+{
+public:
+
+  /**
+   * @enum eHeaterState_t
+   * @brief State of the heater controller
+   */
+  typedef enum{
+    eHeaterIdle = 0,/**<Heater off and cooled down, the samples are valid*/
+    eHeaterOn = 1,/**<Heater on*/
+    eHeaterCooling = 2,/**<Heater off, the sensor is still cooling down or waiting for the next pulse*/
+  } eHeaterState_t;
+
+public:
+
+  /**
+   * @fn DFRobot_SHT3x_Heater
+   * @brief Construct the function
+   * @param sht3x  Driver of the sensor whose heater is controlled.
+   */
+  DFRobot_SHT3x_Heater(DFRobot_SHT3x &sht3x);
+
+  /**
+   * @fn begin
+   * @brief Set the pulse timing.
+   * @param onTimeMs  Heater on-time of one pulse (ms).
+   * @param offTimeMs  Heater off-time between two pulses (ms), extended when needed to respect the maximum duty cycle.
+   * @param maxDutyPercent  Maximum duty cycle (1 to 100%), 50 in default.
+   */
+  void begin(uint32_t onTimeMs,uint32_t offTimeMs,uint8_t maxDutyPercent = 50);
+
+  /**
+   * @fn setCoolDown
+   * @brief Set how long the samples stay flagged after the heater was switched off.
+   * @param coolDownMs  Cool-down time (ms), 10000 in default.
+   */
+  void setCoolDown(uint32_t coolDownMs);
+
+  /**
+   * @fn start
+   * @brief Start pulsing the heater, the first pulse starts at the next update().
+   * @param pulses  Number of pulses, 0 (in default) pulses until stop() is called.
+   */
+  void start(uint16_t pulses = 0);
+
+  /**
+   * @fn stop
+   * @brief Stop pulsing, the heater is switched off at once and the cool-down starts.
+   */
+  void stop();
+
+  /**
+   * @fn update
+   * @brief Advance the state machine, call it from loop() as often as possible. Never waits on a status read,
+   * @n but an update that switches the heater takes the 1 ms gap the driver keeps before every command.
+   * @n In cycle measurement mode the command is sent without a break, the cycle keeps running.
+   * @return Return the state after the update.
+   */
+  eHeaterState_t update();
+
+  /**
+   * @fn getState
+   * @brief Get the state of the controller without advancing it.
+   * @return Return the state with the type eHeaterState_t
+   */
+  eHeaterState_t getState();
+
+  /**
+   * @fn isSampleValid
+   * @brief Whether a sample taken now can be used, false while the heater is on or cooling down.
+   * @return Return true when the sample is not affected by the heater.
+   */
+  bool isSampleValid();
+
+private:
+
+  /**
+   * @fn switchHeater
+   * @brief Send the heater command without the status read-back and change the state.
+   */
+  void switchHeater(bool on,uint32_t now);
+
+private:
+
+  DFRobot_SHT3x *_pSht3x;
+  uint32_t _onTime;
+  uint32_t _offTime;
+  uint32_t _coolDown;
+  uint32_t _since;
+  uint16_t _pulses;
+  uint16_t _done;
+  eHeaterState_t _state;
+  bool _running;
+};
+#endif
@@ -0,0 +1,99 @@
+/*!
+ * @file DFRobot_SHT3x_Mux.cpp
+ * @brief Implementation of the I2C multiplexer routing of the DFRobot_SHT3x transfers
+ *
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include <DFRobot_SHT3x.h>
+
+DFRobot_SHT3x_Mux::DFRobot_SHT3x_Mux(TwoWire *pWire,uint8_t address)
+{
+  _pWire = pWire;
+  _address = address;
+  _channel = SHT3X_MUX_NO_CHANNEL;
+  _switches = 0;
+  _skips = 0;
+}
+
+bool DFRobot_SHT3x_Mux::select(uint8_t channel)
+{
+  if(channel >= SHT3X_MUX_CHANNELS){
+    return false;
+  }
+  if(channel == _channel){
+    _skips++;
+    return true;
+  }
+  _pWire->beginTransmission(_address);
+  _pWire->write(1 << channel);
+  if(_pWire->endTransmission() != 0){
+    _channel = SHT3X_MUX_NO_CHANNEL;
+    return false;
+  }
+  _channel = channel;
+  _switches++;
+  return true;
+}
+
+bool DFRobot_SHT3x_Mux::disable()
+{
+  _channel = SHT3X_MUX_NO_CHANNEL;
+  _pWire->beginTransmission(_address);
+  _pWire->write(0);
+  return _pWire->endTransmission() == 0;
+}
+
+void DFRobot_SHT3x_Mux::invalidate()
+{
+  _channel = SHT3X_MUX_NO_CHANNEL;
+}
+
+uint8_t DFRobot_SHT3x_Mux::getChannel()
+{
+  return _channel;
+}
+
+uint32_t DFRobot_SHT3x_Mux::getSwitchCount()
+{
+  return _switches;
+}
+
+uint32_t DFRobot_SHT3x_Mux::getSkipCount()
+{
+  return _skips;
+}
+
+TwoWire *DFRobot_SHT3x_Mux::getWire()
+{
+  return _pWire;
+}
+
+uint16_t DFRobot_SHT3x_Mux::sweepKey(DFRobot_SHT3x *sensor)
+{
+  if(sensor->getMux() != this){
+    return 0;
+  }
+  //the open channel first, then upwards with wrap around; SHT3X_MUX_NO_CHANNEL (0xFF) gives plain ascending order
+  return 1 + (uint8_t)(sensor->getMuxChannel() - _channel);
+}
+
+void DFRobot_SHT3x_Mux::sortSweep(DFRobot_SHT3x *sensors[],uint8_t count)
+{
+  //insertion sort: stable and cheap for the few sensors of a bus
+  for(uint8_t i = 1; i < count; i++){
+    DFRobot_SHT3x *sensor = sensors[i];
+    uint16_t key = sweepKey(sensor);
+    uint8_t j = i;
+    while(j > 0 && sweepKey(sensors[j - 1]) > key){
+      sensors[j] = sensors[j - 1];
+      j--;
+    }
+    sensors[j] = sensor;
+  }
+}
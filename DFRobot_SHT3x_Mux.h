@@ -0,0 +1,116 @@
+/*!
+ * @file DFRobot_SHT3x_Mux.h
+ * @brief Define the infrastructure of the DFRobot_SHT3x_Mux class
+ * @details Routing of the SHT3x transfers through a TCA9548A style I2C multiplexer (one control byte, one bit per
+ * @n channel), so more than two sensors can share a bus. A DFRobot_SHT3x built on a multiplexer selects its channel
+ * @n before every transfer; the multiplexer remembers the open channel and skips the switch when it is already the
+ * @n right one. A transfer whose channel cannot be selected is dropped as a NACK and the multiplexer forgets the
+ * @n open channel. A NACK of the sensor keeps the open channel (an early fetch is answered NACK), the multiplexer
+ * @n is written again when the sensor checks for a reset (checkReset()) or after invalidate().
+ * @n sortSweep() orders the sensors of a sweep so that each channel is opened once.
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef DFROBOT_SHT3X_MUX_H
+#define DFROBOT_SHT3X_MUX_H
+#include "Arduino.h"
+#include <Wire.h>
+
+#define SHT3X_MUX_CHANNELS      8     ///< Channels of a TCA9548A
+#define SHT3X_MUX_NO_CHANNEL    0xFF  ///< No channel open, or the open channel is unknown
+
+class DFRobot_SHT3x;
+
+class DFRobot_SHT3x_Mux
+{
+public:
+
+  /**
+   * @fn DFRobot_SHT3x_Mux
+   * @brief Construct the function
+   * @param pWire  I2C bus the multiplexer is on, Wire in default.
+   * @param address  Multiplexer address, 0x70 to 0x77 (0x70 in default).
+   */
+  DFRobot_SHT3x_Mux(TwoWire *pWire = &Wire,uint8_t address = 0x70);
+
+  /**
+   * @fn select
+   * @brief Open one channel and close the others, nothing is sent when the channel is already open.
+   * @param channel  0 to SHT3X_MUX_CHANNELS - 1
+   * @return Return false when the channel is out of range or the multiplexer did not acknowledge
+   */
+  bool select(uint8_t channel);
+
+  /**
+   * @fn disable
+   * @brief Close every channel, e.g. before talking to another multiplexer of the same bus.
+   * @return Return false when the multiplexer did not acknowledge
+   */
+  bool disable();
+
+  /**
+   * @fn invalidate
+   * @brief Forget the open channel, the next select() writes the multiplexer again.
+   * @n Call it when something else wrote the multiplexer or it may have been reset (power loss).
+   */
+  void invalidate();
+
+  /**
+   * @fn getChannel
+   * @brief Get the open channel
+   * @return Return the channel, SHT3X_MUX_NO_CHANNEL when none is open or it is unknown
+   */
+  uint8_t getChannel();
+
+  /**
+   * @fn getSwitchCount
+   * @brief Get the number of channel switches written to the multiplexer
+   * @return Return the number of switches
+   */
+  uint32_t getSwitchCount();
+
+  /**
+   * @fn getSkipCount
+   * @brief Get the number of select() calls that found the channel already open
+   * @return Return the number of skipped switches
+   */
+  uint32_t getSkipCount();
+
+  /**
+   * @fn getWire
+   * @brief Get the I2C bus of the multiplexer
+   * @return Return the bus
+   */
+  TwoWire *getWire();
+
+  /**
+   * @fn sortSweep
+   * @brief Order the sensors of a sweep by channel, starting with the open one, so each channel is switched to once.
+   * @n The sensors that are not behind this multiplexer go first, the order inside a channel is kept.
+   * @param sensors  Sensors to sort in place
+   * @param count  Number of sensors
+   */
+  void sortSweep(DFRobot_SHT3x *sensors[],uint8_t count);
+
+private:
+
+  /**
+   * @fn sweepKey
+   * @brief Position of a sensor in a sweep starting from the open channel.
+   */
+  uint16_t sweepKey(DFRobot_SHT3x *sensor);
+
+private:
+
+  TwoWire *_pWire;
+  uint8_t _address;
+  uint8_t _channel;
+  uint32_t _switches;
+  uint32_t _skips;
+};
+#endif
@@ -0,0 +1,140 @@
+/*!
+ * @file DFRobot_SHT3x_PhaseLock.cpp
+ * @brief Implementation of the phase-locked cycle measurement fetch of the DFRobot_SHT3x class
+ * 
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include <DFRobot_SHT3x_PhaseLock.h>
+
+DFRobot_SHT3x_PhaseLock::DFRobot_SHT3x_PhaseLock(DFRobot_SHT3x &sht3x)
+{
+  _pSht3x = &sht3x;
+  _nominalUs = 1000000;
+  _periodUs = 1000000;
+  _readyUs = 0;
+  _nextUs = 0;
+  _nackUs = 0;
+  _refUs = 0;
+  _index = 0;
+  _refIndex = 0;
+  _ageUs = 0;
+  _probeUs = SHT3X_PHASELOCK_PROBE_US;
+  _nacks = 0;
+  _nacked = false;
+  _locked = false;
+  _refSet = false;
+}
+
+bool DFRobot_SHT3x_PhaseLock::begin(DFRobot_SHT3x::eMeasureFrequency_t measureFreq,DFRobot_SHT3x::eRepeatability_t repeatability)
+{
+  const uint16_t periodMs[5] = {2000,1000,500,250,100};
+  if(!_pSht3x->startPeriodicMode(measureFreq,repeatability)){
+    return false;
+  }
+  _nominalUs = (uint32_t)periodMs[measureFreq] * 1000;
+  _periodUs = _nominalUs;
+  _nacks = 0;
+  restart(micros());
+  return true;
+}
+
+void DFRobot_SHT3x_PhaseLock::restart(uint32_t now)
+{
+  //The first sample of the cycle measurement mode is ready after about one conversion
+  _readyUs = now;
+  _nextUs = now + SHT3X_PHASELOCK_RETRY_US;
+  _index = 0;
+  _probeUs = SHT3X_PHASELOCK_PROBE_US;
+  _nacked = false;
+  _locked = false;
+  _refSet = false;
+}
+
+bool DFRobot_SHT3x_PhaseLock::update(DFRobot_SHT3x::sRHAndTemp_t &data)
+{
+  uint32_t now = micros();
+  uint32_t ready;
+  uint32_t n = 0;
+  bool bracketed;
+  if((int32_t)(now - _nextUs) < 0){
+    return false;
+  }
+  data = _pSht3x->readTemperatureAndHumidity();
+  now = micros();
+  if(data.ERR == ERR_NOT_READY){
+    _nacks++;
+    _nacked = true;
+    _nackUs = now;
+    _nextUs = now + SHT3X_PHASELOCK_RETRY_US;
+    //No sample for 2 periods: the chip may have been reset and left cycle measurement mode
+    if(now - _readyUs > 2 * _periodUs){
+      _pSht3x->checkReset();
+      restart(micros());
+    }
+    return false;
+  }
+  //A frame was sent, even with a bad CRC a sample was ready. A wide bracket (the loop stalled) is not precise enough
+  bracketed = _nacked && (now - _nackUs <= 3 * SHT3X_PHASELOCK_RETRY_US);
+  if(_locked){
+    n = (now - _readyUs + _periodUs / 2) / _periodUs;
+    if(n == 0){
+      n = 1;
+    }
+  }
+  if(bracketed){
+    ready = _nackUs + (now - _nackUs) / 2;
+    _probeUs = SHT3X_PHASELOCK_PROBE_US;
+  } else if(_locked){
+    ready = _readyUs + n * _periodUs - _probeUs;
+    if((int32_t)(now - ready) < 0){
+      ready = now;
+    }
+    if(_probeUs < _periodUs / 8){
+      _probeUs *= 2;
+    }
+  } else {
+    ready = now;
+  }
+  _index += n;
+  if(bracketed){
+    if(!_refSet){
+      _refUs = ready;
+      _refIndex = _index;
+      _refSet = true;
+    } else if(_index != _refIndex){
+      _periodUs = (ready - _refUs) / (_index - _refIndex);
+    }
+  }
+  _ageUs = now - ready;
+  _readyUs = ready;
+  _nextUs = ready + _periodUs + SHT3X_PHASELOCK_GUARD_US;
+  _nacked = false;
+  _locked = true;
+  return true;
+}
+
+uint32_t DFRobot_SHT3x_PhaseLock::getPeriodUs()
+{
+  return _periodUs;
+}
+
+int32_t DFRobot_SHT3x_PhaseLock::getDriftPpm()
+{
+  return (int32_t)(((int64_t)_periodUs - _nominalUs) * 1000000 / _nominalUs);
+}
+
+uint32_t DFRobot_SHT3x_PhaseLock::getSampleAgeUs()
+{
+  return _ageUs;
+}
+
+uint32_t DFRobot_SHT3x_PhaseLock::getNackCount()
+{
+  return _nacks;
+}
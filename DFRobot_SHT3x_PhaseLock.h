@@ -0,0 +1,112 @@
+/*!
+ * @file DFRobot_SHT3x_PhaseLock.h
+ * @brief Define the infrastructure of the DFRobot_SHT3x_PhaseLock class
+ * @details In cycle measurement mode the chip measures on its own oscillator, whose period differs from the nominal
+ * @n one and from the MCU clock. This class estimates the real period and the time each new sample becomes ready, from
+ * @n the fetches that succeed and the ones the chip answers NACK, and fetches each sample just after it is ready:
+ * @n one fetch per sample, no duplicate, and a sample age of about a millisecond.
+ * @n Ready time of a sample: a NACK followed by a success brackets it; a success at the first try only bounds it from
+ * @n above, so the predicted time is moved earlier after each such success, by a step doubled every time, until a
+ * @n NACK brackets it again. The period is the distance between two bracketed ready times over the samples in between.
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef DFROBOT_SHT3X_PHASELOCK_H
+#define DFROBOT_SHT3X_PHASELOCK_H
+#include "DFRobot_SHT3x.h"
+
+#define SHT3X_PHASELOCK_RETRY_US    1000  ///< Time between two fetches while the chip answers NACK (µs)
+#define SHT3X_PHASELOCK_GUARD_US    1000  ///< Fetch this long after the predicted ready time (µs)
+#define SHT3X_PHASELOCK_PROBE_US    100   ///< First step the predicted ready time is moved earlier after a first-try success, doubled at each one (µs)
+
+class DFRobot_SHT3x_PhaseLock
+{
+public:
+
+  /**
+   * @fn DFRobot_SHT3x_PhaseLock
+   * @brief Construct the function
+   * @param sht3x  Driver of the sensor, begin() must have succeeded before begin() of this class is called.
+   */
+  DFRobot_SHT3x_PhaseLock(DFRobot_SHT3x &sht3x);
+
+  /**
+   * @fn begin
+   * @brief Enter cycle measurement mode and start tracking its period. The NACKs are part of the tracking, update()
+   * @n checks for a reset itself when no sample came for 2 periods.
+   * @param measureFreq  Measurement frequency with the type eMeasureFrequency_t.
+   * @param repeatability  Repeatability with the type eRepeatability_t, eRepeatability_High in default.
+   * @return Return true when the cycle measurement mode was entered.
+   */
+  bool begin(DFRobot_SHT3x::eMeasureFrequency_t measureFreq,DFRobot_SHT3x::eRepeatability_t repeatability = DFRobot_SHT3x::eRepeatability_High);
+
+  /**
+   * @fn update
+   * @brief Fetch the next sample if it should be ready, call it from loop() as often as possible. Never waits for
+   * @n a conversion, but an update that fetches takes the 1 ms gap the driver keeps before every command; the other
+   * @n updates return at once.
+   * @param data  Receive the sample when one was read.
+   * @return Return true when a frame was read (check data.ERR for the CRC check), false otherwise.
+   */
+  bool update(DFRobot_SHT3x::sRHAndTemp_t &data);
+
+  /**
+   * @fn getPeriodUs
+   * @brief Get the measured period of the chip, the nominal period until two ready times were bracketed.
+   * @return Return the period (µs)
+   */
+  uint32_t getPeriodUs();
+
+  /**
+   * @fn getDriftPpm
+   * @brief Get how far the chip period is from the nominal one, measured with the MCU clock.
+   * @return Return the drift (ppm), positive when the chip is slower than nominal
+   */
+  int32_t getDriftPpm();
+
+  /**
+   * @fn getSampleAgeUs
+   * @brief Get the time between the estimated ready time of the last sample and its fetch.
+   * @return Return the age (µs)
+   */
+  uint32_t getSampleAgeUs();
+
+  /**
+   * @fn getNackCount
+   * @brief Get the number of fetches answered NACK since begin()
+   * @return Return the count
+   */
+  uint32_t getNackCount();
+
+private:
+
+  /**
+   * @fn restart
+   * @brief Forget the phase, the next ready time is searched from now on.
+   */
+  void restart(uint32_t now);
+
+private:
+
+  DFRobot_SHT3x *_pSht3x;
+  uint32_t _nominalUs;
+  uint32_t _periodUs;
+  uint32_t _readyUs;
+  uint32_t _nextUs;
+  uint32_t _nackUs;
+  uint32_t _refUs;
+  uint32_t _index;
+  uint32_t _refIndex;
+  uint32_t _ageUs;
+  uint32_t _probeUs;
+  uint32_t _nacks;
+  bool _nacked;
+  bool _locked;
+  bool _refSet;
+};
+#endif
@@ -0,0 +1,119 @@
+/*!
+ * @file DFRobot_SHT3x_Psychrometrics.cpp
+ * @brief Implementation of the derived metrics (dew point, absolute humidity, heat index) of the DFRobot_SHT3x class
+ * 
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include <DFRobot_SHT3x_Psychrometrics.h>
+#include "math.h"
+
+#define MAGNUS_B_Q12        72172   ///< b = 17.62 in Q12
+#define MAGNUS_C_100        24312   ///< c = 243.12°C in 0.01°C
+#define LOG2_65535_Q15      524287  ///< log2(65535) in Q15
+#define LN2_Q15             22713   ///< ln(2) in Q15
+#define LOG2E_Q12           5909    ///< 1/ln(2) in Q12
+
+//log2(1 + i/32) in Q15
+static const uint16_t log2Table[33] PROGMEM = {
+  0,1455,2866,4236,5568,6863,8124,9352,10549,11716,12855,13968,15055,16117,17156,18173,
+  19168,20143,21098,22034,22952,23852,24736,25604,26455,27292,28114,28922,29717,30498,31267,32024,32768
+};
+
+//2^(i/32) - 1 in Q15
+static const uint16_t exp2Table[33] PROGMEM = {
+  0,718,1451,2200,2966,3748,4548,5365,6200,7053,7925,8816,9727,10657,11608,12580,
+  13573,14588,15625,16684,17767,18874,20005,21160,22341,23548,24781,26041,27329,28645,29989,31364,32768
+};
+
+int32_t DFRobot_SHT3x_Psychrometrics::log2Q15(uint16_t x)
+{
+  uint8_t k = 15;
+  uint16_t f;
+  int32_t lo,hi;
+  while(!(x & 0x8000)){
+    x <<= 1;
+    k--;
+  }
+  //x is now 1.f in Q15, 32 segments with linear interpolation
+  f = x & 0x7FFF;
+  lo = pgm_read_word(&log2Table[f >> 10]);
+  hi = pgm_read_word(&log2Table[(f >> 10) + 1]);
+  return ((int32_t)k << 15) + lo + (((hi - lo) * (f & 0x3FF)) >> 10);
+}
+
+int32_t DFRobot_SHT3x_Psychrometrics::magnus(uint16_t rawTemperature,uint16_t rawHumidity,int32_t &temperature)
+{
+  int32_t lnRH;
+  temperature = ((int32_t)17500 * rawTemperature + 32767) / 65535 - 4500;
+  if(rawHumidity == 0){
+    rawHumidity = 1;
+  }
+  //ln(raw/65535) = (log2(raw) - log2(65535)) * ln(2), Q15 -> Q12
+  lnRH = ((log2Q15(rawHumidity) - LOG2_65535_Q15) >> 3) * LN2_Q15 >> 15;
+  return lnRH + MAGNUS_B_Q12 * temperature / (MAGNUS_C_100 + temperature);
+}
+
+int16_t DFRobot_SHT3x_Psychrometrics::dewPoint(uint16_t rawTemperature,uint16_t rawHumidity)
+{
+  int32_t temperature;
+  int32_t gamma = magnus(rawTemperature,rawHumidity,temperature);
+  //Td = c * gamma / (b - gamma)
+  return MAGNUS_C_100 * gamma / (MAGNUS_B_Q12 - gamma);
+}
+
+uint16_t DFRobot_SHT3x_Psychrometrics::absoluteHumidity(uint16_t rawTemperature,uint16_t rawHumidity)
+{
+  int32_t temperature;
+  int32_t y,lo,hi;
+  int8_t shift;
+  uint16_t f;
+  uint32_t mantissa,k,result;
+  //AH = 216.7 * 6.112 * exp(gamma) / (273.15 + T), exp(gamma) = 2^y
+  y = magnus(rawTemperature,rawHumidity,temperature) * LOG2E_Q12 >> 12;
+  f = y & 0xFFF;
+  lo = pgm_read_word(&exp2Table[f >> 7]);
+  hi = pgm_read_word(&exp2Table[(f >> 7) + 1]);
+  mantissa = 32768 + lo + (((hi - lo) * (f & 0x7F)) >> 7);
+  //1324.5 g/m³ * 100 * 100 * 16 / (27315 + T), then AH * 100 = mantissa * 2^(y >> 12) / 2^15 * k / 16
+  k = 211920000UL / (27315 + temperature);
+  result = mantissa * k;
+  shift = 19 - (y >> 12);
+  if(shift >= 32){
+    return 0;
+  }
+  if(shift <= 0){
+    return 65535;
+  }
+  result = (result + ((uint32_t)1 << (shift - 1))) >> shift;
+  return (result > 65535) ? 65535 : result;
+}
+
+int16_t DFRobot_SHT3x_Psychrometrics::heatIndex(uint16_t rawTemperature,uint16_t rawHumidity)
+{
+  float t = 315.0f * rawTemperature / 65535.0f - 49.0f;
+  float rh = 100.0f * rawHumidity / 65535.0f;
+  float hi = 0.5f * (t + 61.0f + (t - 68.0f) * 1.2f + rh * 0.094f);
+  //NOAA: the simple formula is used below 80°F, the Rothfusz regression and its adjustments above
+  if((hi + t) / 2.0f >= 80.0f){
+    hi = -42.379f + 2.04901523f * t + 10.14333127f * rh - 0.22475541f * t * rh - 0.00683783f * t * t
+         - 0.05481717f * rh * rh + 0.00122874f * t * t * rh + 0.00085282f * t * rh * rh - 0.00000199f * t * t * rh * rh;
+    if(rh < 13.0f && t > 80.0f && t < 112.0f){
+      hi -= (13.0f - rh) / 4.0f * sqrt((17.0f - fabs(t - 95.0f)) / 17.0f);
+    } else if(rh > 85.0f && t > 80.0f && t < 87.0f){
+      hi += (rh - 85.0f) / 10.0f * (87.0f - t) / 5.0f;
+    }
+  }
+  hi = (hi - 32.0f) * 500.0f / 9.0f;
+  if(hi > 32767.0f){
+    return 32767;
+  } else if(hi < -32768.0f){
+    return -32768;
+  }
+  return (int16_t)hi;
+}
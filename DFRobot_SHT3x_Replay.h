@@ -0,0 +1,183 @@
+/*!
+ * @file DFRobot_SHT3x_Replay.h
+ * @brief Define the infrastructure of the DFRobot_SHT3x_Replay class
+ * @details Replay transport for a Linux host: plays a capture of DFRobot_SHT3x_Capture back into a DFRobot_SHT3x,
+ * @n so the NACKs, CRC errors and data of a field node reach the driver byte for byte, and every transfer takes the
+ * @n recorded bus time. The gaps between transfers are the ones the host driver takes (its own delays), unless
+ * @n setPacing() starts each transfer at its recorded time. Each write of the driver is checked against the recorded one; when the driver takes another
+ * @n path than the node did, the mismatch is counted and the replay skips ahead to the next transfer of the same kind.
+ * @n Host only: the class is compiled on Linux outside of Arduino and is empty on the boards.
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef DFROBOT_SHT3X_REPLAY_H
+#define DFROBOT_SHT3X_REPLAY_H
+#if defined(__linux__) && !defined(ARDUINO)
+#include "DFRobot_SHT3x_Capture.h"
+
+class DFRobot_SHT3x_Replay : public DFRobot_SHT3x_Transport
+{
+public:
+
+  /**
+   * @struct sRecord_t
+   * @brief One recorded transfer
+   */
+  typedef struct{
+    uint32_t timeUs;/**<Start of the transfer from the start of the capture*/
+    uint32_t durationUs;/**<Bus time of the transfer*/
+    bool read;/**<true for a read, false for a write*/
+    uint8_t size;/**<Bytes sent, or bytes requested by the read*/
+    uint8_t result;/**<endTransmission status of a write, bytes received by a read*/
+    uint8_t length;/**<Bytes held in data*/
+    const uint8_t *data;/**<Bytes sent or received, points into the capture*/
+  } sRecord_t;
+
+public:
+
+  /**
+   * @fn DFRobot_SHT3x_Replay
+   * @brief Construct the function, timing is on in default.
+   */
+  DFRobot_SHT3x_Replay();
+  ~DFRobot_SHT3x_Replay();
+
+  /**
+   * @fn open
+   * @brief Load a capture file.
+   * @param path  Path of the file written from a DFRobot_SHT3x_Capture
+   * @return Return false when the file cannot be read or is not a valid capture
+   */
+  bool open(const char *path);
+
+  /**
+   * @fn load
+   * @brief Use a capture already in memory, it must stay valid while it is replayed.
+   * @param data  Capture, header included
+   * @param size  Bytes of the capture
+   * @return Return false when it is not a valid capture
+   */
+  bool load(const uint8_t *data,size_t size);
+
+  /**
+   * @fn setTiming
+   * @brief Make every transfer take its recorded bus time, or return at once.
+   * @param enable  true to reproduce the recorded durations
+   */
+  void setTiming(bool enable);
+
+  /**
+   * @fn setPacing
+   * @brief Start every transfer at its recorded time from the start of the replay, waiting when the driver comes
+   * @n early; a driver that comes late is not caught up. Off in default: the gaps between transfers are then the
+   * @n delays the host driver takes itself, not the recorded ones.
+   * @param enable  true to reproduce the recorded gaps
+   */
+  void setPacing(bool enable);
+
+  /**
+   * @fn rewind
+   * @brief Go back to the first record and clear the mismatch count, the pacing restarts from the next transfer.
+   */
+  void rewind();
+
+  /**
+   * @fn readRecord
+   * @brief Take the next record without playing it, to dump or analyse a capture.
+   * @param record  Receive the record
+   * @return Return false at the end of the capture
+   */
+  bool readRecord(sRecord_t &record);
+
+  /**
+   * @fn write
+   * @brief Play the next recorded write, the bytes sent by the driver are compared with the recorded ones.
+   * @return Return the recorded endTransmission() status, 4 (other error) at the end of the capture
+   */
+  uint8_t write(uint8_t address,const uint8_t *pBuf,uint8_t size);
+
+  /**
+   * @fn read
+   * @brief Play the next recorded read, the recorded bytes are copied and the missing ones set to 0xFF.
+   * @return Return the recorded number of bytes received, 0 at the end of the capture
+   */
+  uint8_t read(uint8_t address,uint8_t *pBuf,uint8_t size);
+
+  /**
+   * @fn getAddress
+   * @brief Get the chip address written in the capture header
+   * @return Return the address
+   */
+  uint8_t getAddress();
+
+  /**
+   * @fn getRecordCount / getPosition
+   * @brief Get the number of records of the capture, get the number of records already taken.
+   */
+  uint32_t getRecordCount();
+  uint32_t getPosition();
+
+  /**
+   * @fn getMismatchCount
+   * @brief Get the number of transfers of the driver that did not match the capture since the last rewind
+   * @return Return the number of mismatches, 0 when the driver replayed exactly what the node did
+   */
+  uint32_t getMismatchCount();
+
+  /**
+   * @fn isFinished
+   * @brief Get whether every record was taken
+   * @return Return true at the end of the capture
+   */
+  bool isFinished();
+
+private:
+
+  /**
+   * @fn parse
+   * @brief Decode the record at offset and move offset past it.
+   * @return Return false at the end of the data or on a malformed record
+   */
+  bool parse(size_t &offset,uint32_t &time,sRecord_t &record);
+
+  /**
+   * @fn pace
+   * @brief Wait until the recorded time of a transfer when the pacing is on.
+   */
+  void pace(uint32_t timeUs);
+
+  /**
+   * @fn getVarint
+   * @brief Decode a value written by DFRobot_SHT3x_Capture::putVarint.
+   */
+  bool getVarint(size_t &offset,uint32_t &value);
+
+  /**
+   * @fn release
+   * @brief Free the capture loaded by open().
+   */
+  void release();
+
+private:
+
+  uint8_t *_owned;
+  const uint8_t *_data;
+  size_t _size;
+  size_t _offset;
+  uint32_t _time;
+  uint32_t _records;
+  uint32_t _position;
+  uint32_t _mismatches;
+  uint8_t _address;
+  bool _timing;
+  bool _pacing;
+  bool _paceStarted;
+  uint32_t _paceOriginUs;
+};
+#endif
+#endif
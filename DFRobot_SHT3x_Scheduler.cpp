@@ -0,0 +1,128 @@
+/*!
+ * @file DFRobot_SHT3x_Scheduler.cpp
+ * @brief Implementation of the energy-aware acquisition scheduler of the DFRobot_SHT3x class
+ * 
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include <DFRobot_SHT3x_Scheduler.h>
+
+//Typical conversion time of each repeatability (ms)
+static const float conversionMs[3] = {12.5f,4.5f,2.5f};
+static const uint8_t waitMs[3] = {SHT3X_CONVERSION_TIME_H_MS,SHT3X_CONVERSION_TIME_M_MS,SHT3X_CONVERSION_TIME_L_MS};
+static const uint16_t periodMs[5] = {2000,1000,500,250,100};
+
+DFRobot_SHT3x_Scheduler::DFRobot_SHT3x_Scheduler(DFRobot_SHT3x &sht3x)
+{
+  _pSht3x = &sht3x;
+  _repeatability = DFRobot_SHT3x::eRepeatability_High;
+  _mcuCurrent = SHT3X_CURRENT_MCU_ACTIVE_UA;
+  _averageCurrent = 0;
+  _interval = 0;
+  _lastSample = 0;
+  _freq = 0;
+  _periodic = false;
+  _started = false;
+}
+
+void DFRobot_SHT3x_Scheduler::setMcuCurrent(float currentUA)
+{
+  _mcuCurrent = currentUA;
+}
+
+int8_t DFRobot_SHT3x_Scheduler::periodicFrequency(uint32_t intervalMs)
+{
+  for(uint8_t i = 0; i < 5; i++){
+    if(periodMs[i] <= intervalMs){
+      return i;
+    }
+  }
+  return -1;
+}
+
+float DFRobot_SHT3x_Scheduler::estimateSingleCurrentUA(uint32_t intervalMs,DFRobot_SHT3x::eRepeatability_t repeatability)
+{
+  float busy = waitMs[repeatability] + SHT3X_BUS_TIME_MS;
+  if(intervalMs < busy){
+    return -1;
+  }
+  return SHT3X_CURRENT_IDLE_SINGLE_UA
+       + (SHT3X_CURRENT_MEASURE_UA - SHT3X_CURRENT_IDLE_SINGLE_UA) * conversionMs[repeatability] / intervalMs
+       + _mcuCurrent * busy / intervalMs;
+}
+
+float DFRobot_SHT3x_Scheduler::estimatePeriodicCurrentUA(uint32_t intervalMs,DFRobot_SHT3x::eRepeatability_t repeatability)
+{
+  int8_t freq = periodicFrequency(intervalMs);
+  if(freq < 0){
+    return -1;
+  }
+  return SHT3X_CURRENT_IDLE_PERIODIC_UA
+       + (SHT3X_CURRENT_MEASURE_UA - SHT3X_CURRENT_IDLE_PERIODIC_UA) * conversionMs[repeatability] / periodMs[freq]
+       + _mcuCurrent * SHT3X_BUS_TIME_MS / intervalMs;
+}
+
+bool DFRobot_SHT3x_Scheduler::begin(uint32_t intervalMs,DFRobot_SHT3x::eRepeatability_t repeatability)
+{
+  float single = estimateSingleCurrentUA(intervalMs,repeatability);
+  float periodic = estimatePeriodicCurrentUA(intervalMs,repeatability);
+  bool wasPeriodic = _started && _periodic;
+  _interval = intervalMs;
+  _repeatability = repeatability;
+  _started = true;
+  _lastSample = millis() - intervalMs;
+  if(periodic >= 0 && (single < 0 || periodic < single)){
+    _periodic = true;
+    _freq = periodicFrequency(intervalMs);
+    _averageCurrent = periodic;
+    if(wasPeriodic){
+      _pSht3x->stopPeriodicMode();
+    }
+    return _pSht3x->startPeriodicMode((DFRobot_SHT3x::eMeasureFrequency_t)_freq,repeatability);
+  }
+  _periodic = false;
+  _averageCurrent = single;
+  if(wasPeriodic && !_pSht3x->stopPeriodicMode()){
+    return false;
+  }
+  return single >= 0;
+}
+
+bool DFRobot_SHT3x_Scheduler::update(DFRobot_SHT3x::sRHAndTemp_t &data)
+{
+  uint32_t now = millis();
+  if(!_started || now - _lastSample < _interval){
+    return false;
+  }
+  //Keep the phase of the schedule instead of drifting by the time spent in the read
+  _lastSample += _interval;
+  if(now - _lastSample >= _interval){
+    _lastSample = now;
+  }
+  if(_periodic){
+    data = _pSht3x->readTemperatureAndHumidity();
+  } else {
+    data = _pSht3x->readTemperatureAndHumidity(_repeatability);
+  }
+  return true;
+}
+
+bool DFRobot_SHT3x_Scheduler::isPeriodic()
+{
+  return _periodic;
+}
+
+DFRobot_SHT3x::eMeasureFrequency_t DFRobot_SHT3x_Scheduler::getFrequency()
+{
+  return (DFRobot_SHT3x::eMeasureFrequency_t)_freq;
+}
+
+float DFRobot_SHT3x_Scheduler::getAverageCurrentUA()
+{
+  return _averageCurrent;
+}
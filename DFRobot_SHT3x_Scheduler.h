@@ -0,0 +1,126 @@
+/*!
+ * @file DFRobot_SHT3x_Scheduler.h
+ * @brief Define the infrastructure of the DFRobot_SHT3x_Scheduler class
+ * @details Energy-aware acquisition: given the wanted sample interval and repeatability, the scheduler estimates the
+ * @n average current of the single measurement mode and of the cycle measurement mode, picks the cheaper one and
+ * @n takes care of the mode transitions. The model (typical datasheet values, in µA and ms):
+ * @n ---------------------------------------------------------------------------------------------------------
+ * @n  single measurement : I = Iidle_single + (Imeas - Iidle_single) * tconv / T + Imcu * (twait + tbus) / T
+ * @n  cycle measurement  : I = Iidle_periodic + (Imeas - Iidle_periodic) * tconv / Tsensor + Imcu * tbus / T
+ * @n ---------------------------------------------------------------------------------------------------------
+ * @n T is the wanted interval, Tsensor the period of the slowest frequency not longer than T, tconv the typical
+ * @n conversion time, twait the blocking wait of a single measurement and tbus the time the MCU spends on the bus.
+ * @n Imcu is the current drawn by the MCU while it blocks, it is what makes the cycle mode win at high rates.
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef DFROBOT_SHT3X_SCHEDULER_H
+#define DFROBOT_SHT3X_SCHEDULER_H
+#include "DFRobot_SHT3x.h"
+
+#define SHT3X_CURRENT_IDLE_SINGLE_UA      0.2f  ///< Idle current in single measurement mode (µA)
+#define SHT3X_CURRENT_IDLE_PERIODIC_UA    45.0f ///< Idle current in cycle measurement mode (µA)
+#define SHT3X_CURRENT_MEASURE_UA          600.0f///< Current while measuring (µA)
+#define SHT3X_CURRENT_MCU_ACTIVE_UA       5000.0f///< Default MCU current while blocking on the sensor (µA)
+#define SHT3X_BUS_TIME_MS                 1.0f  ///< MCU time spent on one command + 6 byte read at 100kHz, including the command delay (ms)
+
+class DFRobot_SHT3x_Scheduler
+{
+public:
+
+  /**
+   * @fn DFRobot_SHT3x_Scheduler
+   * @brief Construct the function
+   * @param sht3x  Driver of the sensor to schedule.
+   */
+  DFRobot_SHT3x_Scheduler(DFRobot_SHT3x &sht3x);
+
+  /**
+   * @fn setMcuCurrent
+   * @brief Set the current drawn by the MCU while it waits for the sensor.
+   * @param currentUA  Current (µA), SHT3X_CURRENT_MCU_ACTIVE_UA in default, 0 only counts the sensor.
+   */
+  void setMcuCurrent(float currentUA);
+
+  /**
+   * @fn begin
+   * @brief Choose the cheapest acquisition mode for the wanted interval and put the chip in it.
+   * @param intervalMs  Wanted sample interval (ms).
+   * @param repeatability  Wanted repeatability with the type eRepeatability_t, eRepeatability_High in default.
+   * @return Return true when the mode was entered and can deliver samples at this interval.
+   */
+  bool begin(uint32_t intervalMs,DFRobot_SHT3x::eRepeatability_t repeatability = DFRobot_SHT3x::eRepeatability_High);
+
+  /**
+   * @fn update
+   * @brief Take a sample once the interval has elapsed, never blocks longer than one single measurement.
+   * @param data  Receive the sample.
+   * @return Return true when a new sample was taken (check data.ERR).
+   */
+  bool update(DFRobot_SHT3x::sRHAndTemp_t &data);
+
+  /**
+   * @fn isPeriodic
+   * @brief Get the mode chosen by begin.
+   * @return Return true for the cycle measurement mode, false for the single measurement mode.
+   */
+  bool isPeriodic();
+
+  /**
+   * @fn getFrequency
+   * @brief Get the measurement frequency used in cycle measurement mode.
+   * @return Return the frequency with the type eMeasureFrequency_t
+   */
+  DFRobot_SHT3x::eMeasureFrequency_t getFrequency();
+
+  /**
+   * @fn getAverageCurrentUA
+   * @brief Get the estimated average current of the chosen mode.
+   * @return Return the current (µA)
+   */
+  float getAverageCurrentUA();
+
+  /**
+   * @fn estimateSingleCurrentUA
+   * @brief Estimate the average current of the single measurement mode.
+   * @param intervalMs  Sample interval (ms).
+   * @param repeatability  Repeatability with the type eRepeatability_t.
+   * @return Return the current (µA), a negative value when the interval is shorter than one measurement.
+   */
+  float estimateSingleCurrentUA(uint32_t intervalMs,DFRobot_SHT3x::eRepeatability_t repeatability);
+
+  /**
+   * @fn estimatePeriodicCurrentUA
+   * @brief Estimate the average current of the cycle measurement mode.
+   * @param intervalMs  Sample interval (ms).
+   * @param repeatability  Repeatability with the type eRepeatability_t.
+   * @return Return the current (µA), a negative value when no frequency is fast enough.
+   */
+  float estimatePeriodicCurrentUA(uint32_t intervalMs,DFRobot_SHT3x::eRepeatability_t repeatability);
+
+private:
+
+  /**
+   * @fn periodicFrequency
+   * @brief Slowest frequency whose period is not longer than the interval, -1 when none.
+   */
+  int8_t periodicFrequency(uint32_t intervalMs);
+
+private:
+
+  DFRobot_SHT3x *_pSht3x;
+  DFRobot_SHT3x::eRepeatability_t _repeatability;
+  float _mcuCurrent;
+  float _averageCurrent;
+  uint32_t _interval;
+  uint32_t _lastSample;
+  uint8_t _freq;
+  bool _periodic;
+  bool _started;
+};
+#endif
@@ -0,0 +1,115 @@
+/*!
+ * @file DFRobot_SHT3x_Stats.cpp
+ * @brief Implementation of the streaming statistics accumulator of the DFRobot_SHT3x samples
+ * 
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include <DFRobot_SHT3x_Stats.h>
+
+DFRobot_SHT3x_Stats::DFRobot_SHT3x_Stats(uint8_t ewmaShift)
+{
+  setEwmaShift(ewmaShift);
+  reset();
+}
+
+void DFRobot_SHT3x_Stats::reset()
+{
+  memset(_stats,0,sizeof(_stats));
+  _count = 0;
+}
+
+void DFRobot_SHT3x_Stats::setEwmaShift(uint8_t shift)
+{
+  if(shift > 15){
+    shift = 15;
+  }
+  _ewmaShift = shift;
+}
+
+void DFRobot_SHT3x_Stats::addSample(uint16_t rawTemperature,uint16_t rawHumidity)
+{
+  _count++;
+  update(_stats[eTemperature],rawTemperature);
+  update(_stats[eHumidity],rawHumidity);
+}
+
+void DFRobot_SHT3x_Stats::update(sChannelStats_t &stats,uint16_t raw)
+{
+  int32_t x = (int32_t)raw << SHT3X_STATS_FRAC_BITS;
+  int32_t delta;
+  if(_count == 1){
+    stats.min = raw;
+    stats.max = raw;
+    stats.mean = x;
+    stats.ewma = x;
+    stats.m2 = 0;
+    return;
+  }
+  if(raw < stats.min) stats.min = raw;
+  if(raw > stats.max) stats.max = raw;
+  //Welford: mean += delta/n, m2 += delta*(x - new mean); both factors have the same sign
+  delta = x - stats.mean;
+  //Round to nearest, truncation would bias the mean towards the first samples
+  if(delta >= 0){
+    stats.mean += (delta + (int32_t)(_count >> 1)) / (int32_t)_count;
+  } else {
+    stats.mean += (delta - (int32_t)(_count >> 1)) / (int32_t)_count;
+  }
+  stats.m2 += ((uint64_t)((int64_t)delta * (x - stats.mean))) >> SHT3X_STATS_FRAC_BITS;
+  stats.ewma += (x - stats.ewma) >> _ewmaShift;
+}
+
+uint32_t DFRobot_SHT3x_Stats::getCount()
+{
+  return _count;
+}
+
+const DFRobot_SHT3x_Stats::sChannelStats_t &DFRobot_SHT3x_Stats::getRawStats(eChannel_t channel)
+{
+  return _stats[channel];
+}
+
+float DFRobot_SHT3x_Stats::getMin(eChannel_t channel)
+{
+  return convert(channel,_stats[channel].min);
+}
+
+float DFRobot_SHT3x_Stats::getMax(eChannel_t channel)
+{
+  return convert(channel,_stats[channel].max);
+}
+
+float DFRobot_SHT3x_Stats::getMean(eChannel_t channel)
+{
+  return convert(channel,(float)_stats[channel].mean / (1 << SHT3X_STATS_FRAC_BITS));
+}
+
+float DFRobot_SHT3x_Stats::getEwma(eChannel_t channel)
+{
+  return convert(channel,(float)_stats[channel].ewma / (1 << SHT3X_STATS_FRAC_BITS));
+}
+
+float DFRobot_SHT3x_Stats::getVariance(eChannel_t channel)
+{
+  float scale = (channel == eTemperature) ? 175.0f / 65535.0f : 100.0f / 65535.0f;
+  float variance;
+  if(_count < 2){
+    return 0;
+  }
+  variance = (float)_stats[channel].m2 / (1 << SHT3X_STATS_FRAC_BITS) / (float)(_count - 1);
+  return variance * scale * scale;
+}
+
+float DFRobot_SHT3x_Stats::convert(eChannel_t channel,float raw)
+{
+  if(channel == eTemperature){
+    return 175.0f * raw / 65535.0f - 45.0f;
+  }
+  return 100.0f * raw / 65535.0f;
+}
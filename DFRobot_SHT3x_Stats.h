@@ -0,0 +1,151 @@
+/*!
+ * @file DFRobot_SHT3x_Stats.h
+ * @brief Define the infrastructure of the DFRobot_SHT3x_Stats class
+ * @details Streaming statistics of the SHT3x samples: count, min/max, mean, variance (Welford) and EWMA
+ * @n for temperature and humidity. Everything is accumulated on the raw 16-bit words in fixed point,
+ * @n so feeding a sample costs no float math and the memory used does not grow with the number of samples.
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef DFROBOT_SHT3X_STATS_H
+#define DFROBOT_SHT3X_STATS_H
+#include "Arduino.h"
+
+#define SHT3X_STATS_FRAC_BITS    12  ///< Fractional bits of the fixed-point mean and EWMA (raw word << 12)
+
+class DFRobot_SHT3x_Stats
+{
+public:
+
+  /**
+   * @enum eChannel_t
+   * @brief Select the measured quantity
+   */
+  typedef enum{
+    eTemperature = 0,/**<Temperature channel, values in °C*/
+    eHumidity = 1,/**<Relative humidity channel, values in %RH*/
+  } eChannel_t;
+
+  /**
+   * @struct sChannelStats_t
+   * @brief Accumulator of one channel, all values are in raw sensor units
+   */
+  typedef struct{
+    uint16_t min;/**<Smallest raw word since the last reset*/
+    uint16_t max;/**<Largest raw word since the last reset*/
+    int32_t  mean;/**<Running mean, raw word << SHT3X_STATS_FRAC_BITS*/
+    uint64_t m2;/**<Welford sum of squared deviations, raw^2 << SHT3X_STATS_FRAC_BITS*/
+    int32_t  ewma;/**<Exponentially weighted moving average, raw word << SHT3X_STATS_FRAC_BITS*/
+  } sChannelStats_t;
+
+public:
+
+  /**
+   * @fn DFRobot_SHT3x_Stats
+   * @brief Construct the function
+   * @param ewmaShift  EWMA smoothing factor given as alpha = 1/2^ewmaShift, 3 (alpha = 0.125) in default.
+   */
+  DFRobot_SHT3x_Stats(uint8_t ewmaShift = 3);
+
+  /**
+   * @fn reset
+   * @brief Start a new window, the count and every accumulator are cleared.
+   */
+  void reset();
+
+  /**
+   * @fn setEwmaShift
+   * @brief Set the EWMA smoothing factor, alpha = 1/2^shift.
+   * @param shift  0 to 15, a larger value gives a smoother average.
+   */
+  void setEwmaShift(uint8_t shift);
+
+  /**
+   * @fn addSample
+   * @brief Feed one sample, called by DFRobot_SHT3x after every successful read once attached.
+   * @param rawTemperature  Raw temperature word from the sensor.
+   * @param rawHumidity  Raw humidity word from the sensor.
+   */
+  void addSample(uint16_t rawTemperature,uint16_t rawHumidity);
+
+  /**
+   * @fn getCount
+   * @brief Get the number of samples since the last reset
+   * @return Return the number of samples
+   */
+  uint32_t getCount();
+
+  /**
+   * @fn getRawStats
+   * @brief Get the fixed-point accumulator of one channel, useful to uplink the summary without float math.
+   * @param channel  eTemperature or eHumidity
+   * @return Return the accumulator of the channel
+   */
+  const sChannelStats_t &getRawStats(eChannel_t channel);
+
+  /**
+   * @fn getMin
+   * @brief Get the minimum since the last reset
+   * @param channel  eTemperature(°C) or eHumidity(%RH)
+   * @return Return the minimum
+   */
+  float getMin(eChannel_t channel);
+
+  /**
+   * @fn getMax
+   * @brief Get the maximum since the last reset
+   * @param channel  eTemperature(°C) or eHumidity(%RH)
+   * @return Return the maximum
+   */
+  float getMax(eChannel_t channel);
+
+  /**
+   * @fn getMean
+   * @brief Get the mean since the last reset
+   * @param channel  eTemperature(°C) or eHumidity(%RH)
+   * @return Return the mean
+   */
+  float getMean(eChannel_t channel);
+
+  /**
+   * @fn getVariance
+   * @brief Get the sample variance since the last reset
+   * @param channel  eTemperature(°C²) or eHumidity(%RH²)
+   * @return Return the variance, 0 when fewer than 2 samples were fed
+   */
+  float getVariance(eChannel_t channel);
+
+  /**
+   * @fn getEwma
+   * @brief Get the exponentially weighted moving average
+   * @param channel  eTemperature(°C) or eHumidity(%RH)
+   * @return Return the EWMA
+   */
+  float getEwma(eChannel_t channel);
+
+private:
+
+  /**
+   * @fn update
+   * @brief Feed one raw word into one channel accumulator.
+   */
+  void update(sChannelStats_t &stats,uint16_t raw);
+
+  /**
+   * @fn convert
+   * @brief Convert a raw word (may be fractional) of one channel into °C or %RH.
+   */
+  float convert(eChannel_t channel,float raw);
+
+private:
+
+  sChannelStats_t _stats[2];
+  uint32_t _count;
+  uint8_t _ewmaShift;
+};
+#endif
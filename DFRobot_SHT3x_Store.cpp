@@ -0,0 +1,395 @@
+/*!
+ * @file DFRobot_SHT3x_Store.cpp
+ * @brief Implementation of the memory-mapped sample store of DFRobot_SHT3x
+ *
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include <DFRobot_SHT3x_Store.h>
+#if defined(__linux__) && !defined(ARDUINO)
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define SHT3X_STORE_HEADER_COPY   (SHT3X_STORE_DATA_OFFSET / 2)   ///< Offset of the second header copy, in another disk sector
+
+/**
+ * @struct sHeader_t
+ * @brief Header copy at the start of the file, the CRC covers every byte before it
+ */
+typedef struct{
+  char magic[4];/**<"S3XS"*/
+  uint16_t version;/**<SHT3X_STORE_VERSION*/
+  uint16_t recordSize;/**<sizeof(sRecord_t)*/
+  uint32_t capacity;/**<Records kept*/
+  uint32_t interval;/**<Appends between two commits, spare slots after the kept records*/
+  uint64_t sequence;/**<Number of commits, the copy with the higher one is the newest*/
+  uint64_t head;/**<Records appended since the store was created*/
+  uint32_t reserved;
+  uint32_t crc;/**<CRC-32 of the bytes before*/
+} sHeader_t;
+
+static uint32_t crc32(const uint8_t *data,size_t size)
+{
+  uint32_t crc = 0xFFFFFFFF;
+  for(size_t i = 0; i < size; i++){
+    crc ^= data[i];
+    for(uint8_t bit = 0; bit < 8; bit++){
+      crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : (crc >> 1);
+    }
+  }
+  return ~crc;
+}
+
+DFRobot_SHT3x_Store::DFRobot_SHT3x_Store()
+{
+  _fd = -1;
+  _map = NULL;
+  _mapSize = 0;
+  _records = NULL;
+  _writable = false;
+  _capacity = 0;
+  _interval = 0;
+  _slots = 0;
+  _sequence = 0;
+  _head = 0;
+  _committed = 0;
+  _commitFailures = 0;
+}
+
+DFRobot_SHT3x_Store::~DFRobot_SHT3x_Store()
+{
+  close();
+}
+
+bool DFRobot_SHT3x_Store::open(const char *path,uint32_t capacity,uint32_t commitInterval)
+{
+  struct stat st;
+  close();
+  if(capacity == 0 || commitInterval == 0){
+    return false;
+  }
+  _fd = ::open(path,O_RDWR | O_CREAT,0644);
+  if(_fd < 0){
+    return false;
+  }
+  if(fstat(_fd,&st) != 0){
+    close();
+    return false;
+  }
+  if(st.st_size != 0){
+    if(!map(true)){
+      close();
+      return false;
+    }
+    if(loadHeader()){
+      return true;
+    }
+    //a file cut before its first header reached the disk is created again, any other one is left alone
+    for(size_t i = 0; i < SHT3X_STORE_DATA_OFFSET; i++){
+      if(_map[i] != 0){
+        close();
+        return false;
+      }
+    }
+    munmap(_map,_mapSize);
+    _map = NULL;
+  }
+  //new file: size it, then commit an empty header so it is valid from now on
+  _capacity = capacity;
+  _interval = commitInterval;
+  _slots = capacity + commitInterval;
+  if(ftruncate(_fd,SHT3X_STORE_DATA_OFFSET + (off_t)_slots * sizeof(sRecord_t)) != 0 || !map(true)){
+    close();
+    return false;
+  }
+  if(!writeHeader() || fsync(_fd) != 0){
+    close();
+    return false;
+  }
+  return true;
+}
+
+bool DFRobot_SHT3x_Store::openReadOnly(const char *path)
+{
+  close();
+  _fd = ::open(path,O_RDONLY);
+  if(_fd < 0){
+    return false;
+  }
+  if(!map(false) || !loadHeader()){
+    close();
+    return false;
+  }
+  return true;
+}
+
+void DFRobot_SHT3x_Store::close()
+{
+  if(_map){
+    if(_writable){
+      commit();
+    }
+    munmap(_map,_mapSize);
+  }
+  if(_fd >= 0){
+    ::close(_fd);
+  }
+  _fd = -1;
+  _map = NULL;
+  _mapSize = 0;
+  _records = NULL;
+  _writable = false;
+  _capacity = 0;
+  _interval = 0;
+  _slots = 0;
+  _sequence = 0;
+  _head = 0;
+  _committed = 0;
+  _commitFailures = 0;
+}
+
+bool DFRobot_SHT3x_Store::append(uint64_t timeMs,uint32_t serialNumber,uint16_t rawTemperature,uint16_t rawHumidity)
+{
+  if(!_writable){
+    return false;
+  }
+  //the spare slots are used up: the next slot holds the oldest record the header on the disk still counts
+  if(_head - _committed >= _interval && !commit()){
+    return false;
+  }
+  sRecord_t *record = _records + _head % _slots;
+  if(_head && timeMs < _records[(_head - 1) % _slots].timeMs){
+    return false;
+  }
+  record->timeMs = timeMs;
+  record->serialNumber = serialNumber;
+  record->rawTemperature = rawTemperature;
+  record->rawHumidity = rawHumidity;
+  _head++;
+  if(_head - _committed >= _interval){
+    //the sample is stored whatever the commit gives, a failure is counted and the next appends retry
+    commit();
+  }
+  return true;
+}
+
+bool DFRobot_SHT3x_Store::commit()
+{
+  if(!_writable){
+    return false;
+  }
+  if(_head == _committed){
+    return true;
+  }
+  //the records reach the disk before the header that counts them
+  if(!flush(_committed,_head)){
+    _commitFailures++;
+    return false;
+  }
+  uint64_t committed = _committed;
+  _committed = _head;
+  if(!writeHeader()){
+    _committed = committed;
+    _commitFailures++;
+    return false;
+  }
+  return true;
+}
+
+uint32_t DFRobot_SHT3x_Store::getCommitFailures()
+{
+  return _commitFailures;
+}
+
+uint64_t DFRobot_SHT3x_Store::getCommitted()
+{
+  return _committed;
+}
+
+bool DFRobot_SHT3x_Store::refresh()
+{
+  if(_map == NULL){
+    return false;
+  }
+  if(_writable){
+    return true;
+  }
+  return loadHeader();
+}
+
+uint64_t DFRobot_SHT3x_Store::getFirst()
+{
+  return _head > _capacity ? _head - _capacity : 0;
+}
+
+uint64_t DFRobot_SHT3x_Store::getEnd()
+{
+  return _head;
+}
+
+uint32_t DFRobot_SHT3x_Store::getCapacity()
+{
+  return _capacity;
+}
+
+uint64_t DFRobot_SHT3x_Store::lowerBound(uint64_t timeMs)
+{
+  uint64_t low = getFirst();
+  uint64_t high = _head;
+  while(low < high){
+    uint64_t middle = low + (high - low) / 2;
+    if(_records[middle % _slots].timeMs < timeMs){
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+const DFRobot_SHT3x_Store::sRecord_t *DFRobot_SHT3x_Store::getRecords(uint64_t position,size_t &count)
+{
+  if(_map == NULL || position < getFirst() || position >= _head){
+    count = 0;
+    return NULL;
+  }
+  uint32_t slot = position % _slots;
+  uint64_t available = _head - position;
+  if(available > _slots - slot){
+    available = _slots - slot;
+  }
+  if(count > available){
+    count = available;
+  }
+  return _records + slot;
+}
+
+size_t DFRobot_SHT3x_Store::scan(uint32_t serialNumber,uint64_t fromMs,uint64_t toMs,recordCallback_t callback,void *context)
+{
+  size_t found = 0;
+  if(_map == NULL){
+    return 0;
+  }
+  uint64_t position = lowerBound(fromMs);
+  while(position < _head){
+    size_t count = _head - position;
+    const sRecord_t *records = getRecords(position,count);
+    for(size_t i = 0; i < count; i++){
+      if(records[i].timeMs >= toMs){
+        return found;
+      }
+      if(serialNumber == SHT3X_STORE_ANY_SENSOR || records[i].serialNumber == serialNumber){
+        callback(records + i,context);
+        found++;
+      }
+    }
+    position += count;
+  }
+  return found;
+}
+
+bool DFRobot_SHT3x_Store::map(bool writable)
+{
+  struct stat st;
+  if(fstat(_fd,&st) != 0 || st.st_size < SHT3X_STORE_DATA_OFFSET){
+    return false;
+  }
+  void *p = mmap(NULL,st.st_size,writable ? PROT_READ | PROT_WRITE : PROT_READ,MAP_SHARED,_fd,0);
+  if(p == MAP_FAILED){
+    return false;
+  }
+  _map = (uint8_t *)p;
+  _mapSize = st.st_size;
+  _records = (sRecord_t *)(_map + SHT3X_STORE_DATA_OFFSET);
+  _writable = writable;
+  return true;
+}
+
+bool DFRobot_SHT3x_Store::loadHeader()
+{
+  const sHeader_t *newest = NULL;
+  for(uint8_t i = 0; i < 2; i++){
+    const sHeader_t *header = (const sHeader_t *)(_map + i * SHT3X_STORE_HEADER_COPY);
+    if(memcmp(header->magic,"S3XS",4) != 0 || header->version != SHT3X_STORE_VERSION ||
+       header->recordSize != sizeof(sRecord_t) || header->capacity == 0 || header->interval == 0 ||
+       header->crc != crc32((const uint8_t *)header,offsetof(sHeader_t,crc))){
+      continue;
+    }
+    if(newest == NULL || header->sequence > newest->sequence){
+      newest = header;
+    }
+  }
+  if(newest == NULL){
+    return false;
+  }
+  uint64_t slots = (uint64_t)newest->capacity + newest->interval;
+  if(SHT3X_STORE_DATA_OFFSET + slots * sizeof(sRecord_t) > _mapSize){
+    return false;
+  }
+  _capacity = newest->capacity;
+  _interval = newest->interval;
+  _slots = slots;
+  _sequence = newest->sequence;
+  _head = newest->head;
+  _committed = newest->head;
+  return true;
+}
+
+bool DFRobot_SHT3x_Store::writeHeader()
+{
+  sHeader_t header;
+  memset(&header,0,sizeof(header));
+  memcpy(header.magic,"S3XS",4);
+  header.version = SHT3X_STORE_VERSION;
+  header.recordSize = sizeof(sRecord_t);
+  header.capacity = _capacity;
+  header.interval = _interval;
+  header.sequence = _sequence + 1;
+  header.head = _committed;
+  header.crc = crc32((const uint8_t *)&header,offsetof(sHeader_t,crc));
+  //the copy of the previous commit stays intact until this one is on the disk
+  memcpy(_map + (header.sequence & 1) * SHT3X_STORE_HEADER_COPY,&header,sizeof(header));
+  if(msync(_map,SHT3X_STORE_DATA_OFFSET,MS_SYNC) != 0){
+    return false;
+  }
+  _sequence = header.sequence;
+  return true;
+}
+
+bool DFRobot_SHT3x_Store::flush(uint64_t begin,uint64_t end)
+{
+  static const size_t page = sysconf(_SC_PAGESIZE);
+  uint32_t first = begin % _slots;
+  uint32_t last = end % _slots;
+  if(end - begin >= _slots){
+    first = 0;
+    last = _slots;
+  }
+  //a wrapped range is flushed in two parts
+  uint32_t ranges[2][2] = {{first,last},{0,0}};
+  if(first >= last){
+    ranges[0][1] = _slots;
+    ranges[1][1] = last;
+  }
+  for(uint8_t i = 0; i < 2; i++){
+    if(ranges[i][0] == ranges[i][1]){
+      continue;
+    }
+    size_t from = SHT3X_STORE_DATA_OFFSET + (size_t)ranges[i][0] * sizeof(sRecord_t);
+    size_t to = SHT3X_STORE_DATA_OFFSET + (size_t)ranges[i][1] * sizeof(sRecord_t);
+    from -= from % page;
+    if(msync(_map + from,to - from,MS_SYNC) != 0){
+      return false;
+    }
+  }
+  return true;
+}
+#endif
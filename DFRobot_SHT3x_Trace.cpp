@@ -0,0 +1,129 @@
+/*!
+ * @file DFRobot_SHT3x_Trace.cpp
+ * @brief Implementation of the timeline recorder of the DFRobot_SHT3x operations
+ *
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include <DFRobot_SHT3x_Trace.h>
+
+DFRobot_SHT3x_Trace::DFRobot_SHT3x_Trace(sEvent_t *events,uint16_t capacity)
+{
+  _events = events;
+  _capacity = capacity;
+  clear();
+}
+
+void DFRobot_SHT3x_Trace::record(eOperation_t operation,ePhase_t phase,uint16_t arg)
+{
+  if(_capacity == 0){
+    return;
+  }
+  sEvent_t &event = _events[_head];
+  event.timeUs = micros();
+  event.arg = arg;
+  event.operation = operation;
+  event.phase = phase;
+  if(++_head == _capacity){
+    _head = 0;
+  }
+  if(_count < _capacity){
+    _count++;
+  } else {
+    _dropped++;
+  }
+}
+
+void DFRobot_SHT3x_Trace::clear()
+{
+  _head = 0;
+  _count = 0;
+  _dropped = 0;
+}
+
+uint16_t DFRobot_SHT3x_Trace::getCount()
+{
+  return _count;
+}
+
+uint32_t DFRobot_SHT3x_Trace::getDropped()
+{
+  return _dropped;
+}
+
+const DFRobot_SHT3x_Trace::sEvent_t &DFRobot_SHT3x_Trace::getEvent(uint16_t index)
+{
+  //the oldest event sits at _head once the buffer has wrapped
+  uint32_t slot = (uint32_t)_head + _capacity - _count + index;
+  return _events[slot % _capacity];
+}
+
+#if defined(__linux__) && !defined(ARDUINO)
+size_t DFRobot_SHT3x_Trace::exportChromeTrace(FILE *fp)
+{
+  static const char *names[] = {"write","read","command","delay","user"};
+  uint64_t timeUs = 0;
+  uint32_t last = 0;
+  uint16_t depth = 0;
+  size_t written = 0;
+  fprintf(fp,"{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+  for(uint16_t i = 0; i < _count; i++){
+    const sEvent_t &event = getEvent(i);
+    if(i == 0){
+      timeUs = event.timeUs;
+    } else {
+      timeUs += (uint32_t)(event.timeUs - last);
+    }
+    last = event.timeUs;
+    if(event.phase == eTraceEnd){
+      if(depth == 0){
+        continue;
+      }
+      depth--;
+    } else {
+      depth++;
+    }
+    const char *name = event.operation <= eTraceUser ? names[event.operation] : "unknown";
+    fprintf(fp,"%s\n{\"name\":\"%s\",\"cat\":\"sht3x\",\"ph\":\"%c\",\"ts\":%llu,\"pid\":1,\"tid\":1,\"args\":{",
+            written ? "," : "",name,event.phase == eTraceBegin ? 'B' : 'E',(unsigned long long)timeUs);
+    switch(event.operation){
+      case eTraceWrite:
+      case eTraceCommand:
+        if(event.phase == eTraceBegin){
+          fprintf(fp,"\"cmd\":\"0x%04X\"",event.arg);
+        }
+        break;
+      case eTraceRead:
+        fprintf(fp,event.phase == eTraceBegin ? "\"size\":%u" : "\"received\":%u",event.arg);
+        break;
+      case eTraceDelay:
+        if(event.phase == eTraceBegin){
+          fprintf(fp,"\"ms\":%u",event.arg);
+        }
+        break;
+      default:
+        fprintf(fp,"\"arg\":%u",event.arg);
+        break;
+    }
+    fprintf(fp,"}}");
+    written++;
+  }
+  fprintf(fp,"\n]}\n");
+  return written;
+}
+
+bool DFRobot_SHT3x_Trace::exportChromeTrace(const char *path)
+{
+  FILE *fp = fopen(path,"w");
+  if(fp == NULL){
+    return false;
+  }
+  exportChromeTrace(fp);
+  return fclose(fp) == 0;
+}
+#endif
@@ -0,0 +1,133 @@
+/*!
+ * @file DFRobot_SHT3x_Trace.h
+ * @brief Define the infrastructure of the DFRobot_SHT3x_Trace class
+ * @details Timeline recorder of the driver operations. Once attached to a DFRobot_SHT3x, every bus write, bus read,
+ * @n command and delay logs a begin and an end event with its micros() time into a fixed-size ring buffer owned by the
+ * @n caller, so the interleaving of delays and transfers inside a call like environmentState() can be seen.
+ * @n On a Linux host the buffer can be exported as Chrome trace JSON, to be opened by chrome://tracing or Perfetto.
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef DFROBOT_SHT3X_TRACE_H
+#define DFROBOT_SHT3X_TRACE_H
+#include "Arduino.h"
+#if defined(__linux__) && !defined(ARDUINO)
+#include <stdio.h>
+#endif
+
+class DFRobot_SHT3x_Trace
+{
+public:
+
+  /**
+   * @enum eOperation_t
+   * @brief Operation an event belongs to, the meaning of the event argument depends on it
+   */
+  typedef enum{
+    eTraceWrite = 0,/**<Bus write, the argument is the first two bytes sent (the command)*/
+    eTraceRead = 1,/**<Bus read, the argument is the requested size at begin and the received size at end*/
+    eTraceCommand = 2,/**<writeCommand(), the argument is the command*/
+    eTraceDelay = 3,/**<Blocking delay of the driver, the argument is the time in ms*/
+    eTraceUser = 4,/**<Span marked by the application around a driver call, the argument is free*/
+  } eOperation_t;
+
+  /**
+   * @enum ePhase_t
+   * @brief Begin or end of an operation
+   */
+  typedef enum{
+    eTraceBegin = 0,
+    eTraceEnd = 1,
+  } ePhase_t;
+
+  /**
+   * @struct sEvent_t
+   * @brief One logged event, 8 bytes
+   */
+  typedef struct{
+    uint32_t timeUs;/**<micros() when the event was logged*/
+    uint16_t arg;/**<Argument of the operation*/
+    uint8_t operation;/**<eOperation_t*/
+    uint8_t phase;/**<ePhase_t*/
+  } sEvent_t;
+
+public:
+
+  /**
+   * @fn DFRobot_SHT3x_Trace
+   * @brief Construct the function
+   * @param events  Storage of the ring buffer, owned by the caller.
+   * @param capacity  Number of events the storage holds, the oldest events are overwritten when it is full.
+   */
+  DFRobot_SHT3x_Trace(sEvent_t *events,uint16_t capacity);
+
+  /**
+   * @fn record
+   * @brief Log one event, called by DFRobot_SHT3x once attached. The application can mark its own spans with eTraceUser.
+   * @param operation  Operation of the event
+   * @param phase  eTraceBegin or eTraceEnd
+   * @param arg  Argument of the operation
+   */
+  void record(eOperation_t operation,ePhase_t phase,uint16_t arg = 0);
+
+  /**
+   * @fn clear
+   * @brief Drop every logged event.
+   */
+  void clear();
+
+  /**
+   * @fn getCount
+   * @brief Get the number of events held in the buffer
+   * @return Return the number of events, at most the capacity
+   */
+  uint16_t getCount();
+
+  /**
+   * @fn getDropped
+   * @brief Get the number of events overwritten since the last clear
+   * @return Return the number of overwritten events
+   */
+  uint32_t getDropped();
+
+  /**
+   * @fn getEvent
+   * @brief Get one event, oldest first
+   * @param index  0 to getCount() - 1
+   * @return Return the event
+   */
+  const sEvent_t &getEvent(uint16_t index);
+
+#if defined(__linux__) && !defined(ARDUINO)
+  /**
+   * @fn exportChromeTrace
+   * @brief Write the events as Chrome trace JSON (duration events, one track), host only.
+   * @details The 32-bit micros() wrap is unrolled, an end whose begin was overwritten is skipped.
+   * @param fp  File opened for writing.
+   * @return Return the number of events written
+   */
+  size_t exportChromeTrace(FILE *fp);
+
+  /**
+   * @fn exportChromeTrace
+   * @brief Write the events as Chrome trace JSON into a new file, host only.
+   * @param path  Path of the file, replaced when it exists.
+   * @return Return true when the file was written
+   */
+  bool exportChromeTrace(const char *path);
+#endif
+
+private:
+
+  sEvent_t *_events;
+  uint16_t _capacity;
+  uint16_t _head;
+  uint16_t _count;
+  uint32_t _dropped;
+};
+#endif
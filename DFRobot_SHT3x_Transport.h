@@ -0,0 +1,47 @@
+/*!
+ * @file DFRobot_SHT3x_Transport.h
+ * @brief Define the infrastructure of the DFRobot_SHT3x_Transport interface
+ * @details Replaces the TwoWire transfers of a DFRobot_SHT3x once set by setTransport(): every bus write and bus
+ * @n read of the driver goes through it. DFRobot_SHT3x_Capture records the transfers of a real bus,
+ * @n DFRobot_SHT3x_Replay plays a capture back on a Linux host.
+ * @copyright   Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef DFROBOT_SHT3X_TRANSPORT_H
+#define DFROBOT_SHT3X_TRANSPORT_H
+#include "Arduino.h"
+
+class DFRobot_SHT3x_Transport
+{
+public:
+
+  /**
+   * @fn write
+   * @brief Send bytes to the chip in one transfer.
+   * @param address  Chip IIC address
+   * @param pBuf  Bytes to send
+   * @param size  Number of bytes
+   * @return Return the endTransmission() status, 0 when the chip acknowledged
+   */
+  virtual uint8_t write(uint8_t address,const uint8_t *pBuf,uint8_t size) = 0;
+
+  /**
+   * @fn read
+   * @brief Read bytes from the chip in one transfer, the bytes not received are set to 0xFF.
+   * @param address  Chip IIC address
+   * @param pBuf  Receive size bytes
+   * @param size  Number of bytes to read
+   * @return Return the number of bytes the chip sent, 0 when it answered NACK
+   */
+  virtual uint8_t read(uint8_t address,uint8_t *pBuf,uint8_t size) = 0;
+
+protected:
+
+  ~DFRobot_SHT3x_Transport(){}
+};
+#endif
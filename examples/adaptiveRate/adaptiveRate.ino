@@ -0,0 +1,50 @@
+/*!
+ * @file adaptiveRate.ino
+ * @brief Let the measurement frequency follow the activity of the signal in cycle measurement mode.
+ * @details Experimental phenomenon: the chip starts measuring at 0.5Hz. Breathe on the sensor: the humidity rises fast and
+ * @n the frequency jumps to 10Hz, then once the readings settle it steps back down to 0.5Hz one frequency at a time.
+ * @n The frequency in use and the data are printed at the serial port after every sample.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+*/
+
+#include <DFRobot_SHT3x.h>
+#include <DFRobot_SHT3x_AdaptiveRate.h>
+
+DFRobot_SHT3x sht3x;
+DFRobot_SHT3x_AdaptiveRate adaptive(sht3x);
+
+void setup() {
+
+  Serial.begin(9600);
+  while (sht3x.begin() != 0) {
+    Serial.println("Failed to initialize the chip, please confirm the chip connection");
+    delay(1000);
+  }
+  /**
+   * setThresholds Rates of change (°C/s, %RH/s) that switch to the fastest frequency (attack) and that count as stable (release)
+   */
+  adaptive.setThresholds(/*attackC=*/0.5, /*releaseC=*/0.1, /*attackRH=*/2.0, /*releaseRH=*/0.5);
+  adaptive.setHoldSamples(10);
+  if(!adaptive.begin(sht3x.eMeasureFreq_Hz5, sht3x.eMeasureFreq_10Hz)){
+    Serial.println("Failed to enter the periodic mode");
+  }
+}
+
+void loop() {
+  //Wait one measurement period of the frequency currently used
+  delay(adaptive.getPeriodMs());
+  DFRobot_SHT3x::sRHAndTemp_t data = adaptive.readTemperatureAndHumidity();
+  if(data.ERR == 0){
+    Serial.print("period(ms):");
+    Serial.print(adaptive.getPeriodMs());
+    Serial.print(" temperature(°C):");
+    Serial.print(data.TemperatureC);
+    Serial.print(" humidity(%RH):");
+    Serial.println(data.Humidity);
+  }
+}
@@ -0,0 +1,56 @@
+/*!
+ * @file alertEngine.ino
+ * @brief Watch several temperature and humidity windows with hysteresis in software.
+ * @details Experimental phenomenon: a line is printed only when a rule changes state, e.g. warm the sensor with a finger
+ * @n above 30°C to set the "hot" rule, it is cleared once the temperature is back below 29°C.
+ * @n A gateway fills the sample batch with one raw sample per node and evaluates all the rules in one call.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+*/
+
+#include <DFRobot_SHT3x.h>
+#include <DFRobot_SHT3x_AlertEngine.h>
+
+DFRobot_SHT3x sht3x;
+
+DFRobot_SHT3x_AlertEngine::sRule_t rules[4];
+DFRobot_SHT3x_AlertEngine engine(rules, 4);
+
+const char *ruleNames[4] = {"hot", "frost", "dry", "humid"};
+const char *transitionNames[4] = {"high set", "high cleared", "low set", "low cleared"};
+
+void setup() {
+  Serial.begin(9600);
+  while (sht3x.begin() != 0) {
+    Serial.println("Failed to initialize the chip, please confirm the chip connection");
+    delay(1000);
+  }
+  /**
+   * addRule(sensor, channel, highSet, highClear, lowClear, lowSet), a window that is not used is put out of range
+   */
+  engine.addRule(0, engine.eTemperature, 30, 29, -50, -50);
+  engine.addRule(0, engine.eTemperature, 200, 200, 3, 2);
+  engine.addRule(0, engine.eHumidity, 200, 200, 32, 30);
+  engine.addRule(0, engine.eHumidity, 70, 65, -1, -1);
+}
+
+void loop() {
+  DFRobot_SHT3x_AlertEngine::sSample_t sample;
+  DFRobot_SHT3x_AlertEngine::sEvent_t events[8];
+  uint16_t n;
+  if(sht3x.readTemperatureAndHumidity(sht3x.eRepeatability_High).ERR == 0){
+    sample.rawTemperature = sht3x.getRawTemperature();
+    sample.rawHumidity = sht3x.getRawHumidity();
+    n = engine.evaluate(&sample, 1, events, 8);
+    for(uint16_t i = 0; i < n; i++){
+      Serial.print(ruleNames[events[i].rule]);
+      Serial.print(": ");
+      Serial.println(transitionNames[events[i].transition]);
+    }
+  }
+  delay(1000);
+}
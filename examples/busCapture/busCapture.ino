@@ -0,0 +1,37 @@
+/*!
+ * @file busCapture.ino
+ * @brief Record every IIC transfer between the driver and the chip, to replay it on a PC.
+ * @details Experimental phenomenon: the transfers of begin(), of the start of the 10Hz periodic mode and of one
+ * @n read every 100ms are done on the bus as usual and written, as a binary capture, to the serial port.
+ * @n Nothing else is printed so that the port carries the capture only; save it on the PC with e.g.
+ * @n   stty -F /dev/ttyACM0 115200 raw && cat /dev/ttyACM0 > capture.bin
+ * @n then play it back with extras/busReplay, which runs the same calls as this sketch.
+ * @n With an SD card, pass an open File instead of Serial to the capture.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+*/
+
+#include <DFRobot_SHT3x.h>
+#include <DFRobot_SHT3x_Capture.h>
+
+DFRobot_SHT3x sht3x;
+DFRobot_SHT3x_Capture capture(Serial);
+
+void setup() {
+  Serial.begin(115200);
+  sht3x.setTransport(&capture);
+  while (sht3x.begin() != 0) {
+    delay(1000);
+  }
+  sht3x.startPeriodicMode(sht3x.eMeasureFreq_10Hz);
+}
+
+void loop() {
+  //The readings are in the capture, the replay prints them
+  sht3x.readTemperatureAndHumidity();
+  delay(100);
+}
@@ -0,0 +1,75 @@
+/*!
+ * @file events.ino
+ * @brief Read the sensor through callbacks from a loop that never waits for a conversion.
+ * @details Experimental phenomenon: a sample is printed every second by onSample, while loop() keeps blinking the
+ * @n LED every 100ms without jitter. Alerts, read errors and chip resets are reported by their own callbacks.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+*/
+
+#include <DFRobot_SHT3x.h>
+#include <DFRobot_SHT3x_Events.h>
+
+DFRobot_SHT3x sht3x;
+DFRobot_SHT3x_Events events(sht3x);
+
+uint32_t lastBlink = 0;
+bool led = false;
+
+void printSample(const DFRobot_SHT3x::sRHAndTemp_t &data)
+{
+  Serial.print("Temperature:");
+  Serial.print(data.TemperatureC);
+  Serial.print(" C ");
+  Serial.print("Humidity:");
+  Serial.print(data.Humidity);
+  Serial.println(" %RH");
+}
+
+void printAlert(bool alert)
+{
+  Serial.println(alert ? "alert set" : "alert cleared");
+}
+
+void printError(int err)
+{
+  Serial.print("read error:");
+  Serial.println(err);
+}
+
+void printReset()
+{
+  Serial.println("the chip was reset, configuration restored");
+}
+
+void setup() {
+  Serial.begin(9600);
+  pinMode(LED_BUILTIN, OUTPUT);
+  while (sht3x.begin() != 0) {
+    Serial.println("Failed to initialize the chip, please confirm the chip connection");
+    delay(1000);
+  }
+  events.onSample(printSample);
+  events.onAlert(printAlert);
+  events.onError(printError);
+  events.onReset(printReset);
+  /**
+   * setAlertPolling The ALERT pin is not wired in this example, read the status register every 5 seconds instead.
+   * With the pin wired, call events.setAlertPin(pin) and no bus access is needed for the alert.
+   */
+  events.setAlertPolling(5000);
+  events.begin(/*intervalMs=*/1000, sht3x.eRepeatability_High);
+}
+
+void loop() {
+  events.update();
+  if(millis() - lastBlink >= 100){
+    lastBlink = millis();
+    led = !led;
+    digitalWrite(LED_BUILTIN, led);
+  }
+}
@@ -0,0 +1,50 @@
+/*!
+ * @file heaterPulse.ino
+ * @brief Pulse the heater to clear condensation without blocking the main loop.
+ * @details Experimental phenomenon: the heater is switched on for 2 seconds every 8 seconds, 3 times, while a sample is
+ * @n read every 500ms. Samples taken while the heater is on or cooling down are printed as "excluded", the others as usual.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+*/
+
+#include <DFRobot_SHT3x.h>
+#include <DFRobot_SHT3x_Heater.h>
+
+DFRobot_SHT3x sht3x;
+DFRobot_SHT3x_Heater heater(sht3x);
+unsigned long lastSample = 0;
+
+void setup() {
+
+  Serial.begin(9600);
+  while (sht3x.begin() != 0) {
+    Serial.println("Failed to initialize the chip, please confirm the chip connection");
+    delay(1000);
+  }
+  /**
+   * begin Set the heater on-time, off-time (ms) and maximum duty cycle (%)
+   */
+  heater.begin(/*onTimeMs=*/2000, /*offTimeMs=*/6000, /*maxDutyPercent=*/25);
+  heater.setCoolDown(10000);
+  heater.start(/*pulses=*/3);
+}
+
+void loop() {
+  //Advance the heater state machine, a call that switches the heater takes the 1 ms command gap
+  heater.update();
+  if(millis() - lastSample >= 500){
+    lastSample = millis();
+    DFRobot_SHT3x::sRHAndTemp_t data = sht3x.readTemperatureAndHumidity(sht3x.eRepeatability_High);
+    if(data.ERR == 0){
+      Serial.print(heater.isSampleValid() ? "valid    " : "excluded ");
+      Serial.print("temperature(°C):");
+      Serial.print(data.TemperatureC);
+      Serial.print(" humidity(%RH):");
+      Serial.println(data.Humidity);
+    }
+  }
+}
@@ -0,0 +1,66 @@
+/*!
+ * @file muxSweep.ino
+ * @brief Read four SHT3x behind a TCA9548A multiplexer, with the sweep ordered by channel.
+ * @details Experimental phenomenon: the sensors are declared in wiring order, sortSweep() groups them by channel,
+ * @n then every second each sensor is read and printed. The number of channel switches written to the multiplexer
+ * @n and of switches skipped because the channel was already open are printed after each sweep:
+ * @n one switch per channel in use, whatever the number of transfers.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+*/
+
+#include <DFRobot_SHT3x.h>
+
+#define SENSORS 4
+
+DFRobot_SHT3x_Mux mux(&Wire, 0x70);
+
+/**
+ * Multiplexer, channel, chip address: two chips can share a channel when one has ADR to GND (0x44)
+ */
+DFRobot_SHT3x sht3x0(&mux, 2, 0x44);
+DFRobot_SHT3x sht3x1(&mux, 0, 0x45);
+DFRobot_SHT3x sht3x2(&mux, 2, 0x45);
+DFRobot_SHT3x sht3x3(&mux, 1, 0x45);
+
+DFRobot_SHT3x *sensors[SENSORS] = {&sht3x0, &sht3x1, &sht3x2, &sht3x3};
+
+void setup() {
+  Serial.begin(9600);
+  for(uint8_t i = 0; i < SENSORS; i++){
+    while (sensors[i]->begin() != 0) {
+      Serial.print("Failed to Initialize the chip on channel ");
+      Serial.println(sensors[i]->getMuxChannel());
+      delay(1000);
+    }
+  }
+  mux.sortSweep(sensors, SENSORS);
+}
+
+void loop() {
+  uint32_t switches = mux.getSwitchCount();
+  uint32_t skips = mux.getSkipCount();
+  for(uint8_t i = 0; i < SENSORS; i++){
+    DFRobot_SHT3x::sRHAndTemp_t data = sensors[i]->readTemperatureAndHumidity(DFRobot_SHT3x::eRepeatability_High);
+    Serial.print("channel ");
+    Serial.print(sensors[i]->getMuxChannel());
+    if(data.ERR != 0){
+      Serial.println(": read error");
+      continue;
+    }
+    Serial.print(": ");
+    Serial.print(data.TemperatureC);
+    Serial.print(" C, ");
+    Serial.print(data.Humidity);
+    Serial.println(" %RH");
+  }
+  Serial.print("switches ");
+  Serial.print(mux.getSwitchCount() - switches);
+  Serial.print(", skipped ");
+  Serial.println(mux.getSkipCount() - skips);
+  delay(1000);
+}
@@ -0,0 +1,80 @@
+/*!
+ * @file oversampling.ino
+ * @brief Compare latency and noise of one high repeatability conversion against averaged low/medium repeatability conversions.
+ * @details Experimental phenomenon: in single measurement mode, every configuration of the table below is read 20 times in a
+ * @n stable environment. For each one the serial port prints the average time per result (ms), the noise estimate returned by
+ * @n the driver and the standard deviation actually observed between the 20 results, so the configuration with the lowest
+ * @n noise per ms can be chosen for the application.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+*/
+
+#include <DFRobot_SHT3x.h>
+
+#define ROUNDS 20
+
+DFRobot_SHT3x sht3x;
+
+typedef struct{
+  DFRobot_SHT3x::eRepeatability_t repeatability;
+  uint8_t samples;
+  const char *name;
+} sConfig_t;
+
+const sConfig_t configs[] = {
+  {DFRobot_SHT3x::eRepeatability_High,   1, "high   x1"},
+  {DFRobot_SHT3x::eRepeatability_Medium, 1, "medium x1"},
+  {DFRobot_SHT3x::eRepeatability_Medium, 2, "medium x2"},
+  {DFRobot_SHT3x::eRepeatability_Low,    1, "low    x1"},
+  {DFRobot_SHT3x::eRepeatability_Low,    3, "low    x3"},
+  {DFRobot_SHT3x::eRepeatability_Low,    4, "low    x4"},
+  {DFRobot_SHT3x::eRepeatability_Low,    8, "low    x8"},
+};
+
+void benchmark(const sConfig_t &config)
+{
+  DFRobot_SHT3x_Stats observed;
+  float noise = 0;
+  unsigned long start = micros();
+  for(uint8_t i = 0; i < ROUNDS; i++){
+    DFRobot_SHT3x::sOversampledRHAndTemp_t data = sht3x.readTemperatureAndHumidity(config.repeatability, config.samples);
+    if(data.ERR == 0){
+      noise += data.TemperatureNoiseC;
+      //Feed the averaged result back as raw word to measure the spread between results
+      observed.addSample((data.TemperatureC + 45.0f) / 175.0f * 65535.0f + 0.5f, data.Humidity / 100.0f * 65535.0f + 0.5f);
+    }
+  }
+  unsigned long elapsed = micros() - start;
+  Serial.print(config.name);
+  Serial.print("  ms/result:");
+  Serial.print(elapsed / 1000.0f / ROUNDS);
+  Serial.print("  estimated noise(C):");
+  Serial.print(noise / ROUNDS, 4);
+  Serial.print("  observed std dev(C):");
+  Serial.print(sqrt(observed.getVariance(DFRobot_SHT3x_Stats::eTemperature)), 4);
+  Serial.print("  observed std dev(%RH):");
+  Serial.println(sqrt(observed.getVariance(DFRobot_SHT3x_Stats::eHumidity)), 4);
+}
+
+void setup() {
+
+  Serial.begin(9600);
+  while (sht3x.begin() != 0) {
+    Serial.println("Failed to initialize the chip, please confirm the chip connection");
+    delay(1000);
+  }
+  if(!sht3x.softReset()){
+    Serial.println("Failed to reset the chip");
+  }
+  Serial.println("------------------Oversampling benchmark-----------------------");
+  for(uint8_t i = 0; i < sizeof(configs) / sizeof(configs[0]); i++){
+    benchmark(configs[i]);
+  }
+}
+
+void loop() {
+}
@@ -0,0 +1,52 @@
+/*!
+ * @file phaseLock.ino
+ * @brief Fetch every sample of the cycle measurement mode once, just after the chip made it.
+ * @details Experimental phenomenon: each sample is printed with its age, and every 10 seconds the measured period of
+ * @n the chip, its drift from the nominal 100ms and the number of fetches answered NACK are printed.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+*/
+
+#include <DFRobot_SHT3x.h>
+#include <DFRobot_SHT3x_PhaseLock.h>
+
+DFRobot_SHT3x sht3x;
+DFRobot_SHT3x_PhaseLock phaseLock(sht3x);
+
+uint32_t lastReport = 0;
+
+void setup() {
+  Serial.begin(9600);
+  while (sht3x.begin() != 0) {
+    Serial.println("Failed to initialize the chip, please confirm the chip connection");
+    delay(1000);
+  }
+  if(!phaseLock.begin(sht3x.eMeasureFreq_10Hz, sht3x.eRepeatability_High)){
+    Serial.println("Failed to enter the periodic mode");
+  }
+}
+
+void loop() {
+  DFRobot_SHT3x::sRHAndTemp_t data;
+  if(phaseLock.update(data) && data.ERR == 0){
+    Serial.print("Temperature:");
+    Serial.print(data.TemperatureC);
+    Serial.print(" C Humidity:");
+    Serial.print(data.Humidity);
+    Serial.print(" %RH age(us):");
+    Serial.println(phaseLock.getSampleAgeUs());
+  }
+  if(millis() - lastReport >= 10000){
+    lastReport = millis();
+    Serial.print("period(us):");
+    Serial.print(phaseLock.getPeriodUs());
+    Serial.print(" drift(ppm):");
+    Serial.print(phaseLock.getDriftPpm());
+    Serial.print(" NACK:");
+    Serial.println(phaseLock.getNackCount());
+  }
+}
@@ -0,0 +1,102 @@
+/*!
+ * @file psychrometrics.ino
+ * @brief Print the dew point, absolute humidity and heat index, and time them against the math.h Magnus formula.
+ * @details Experimental phenomenon: the time per call (µs and CPU cycles) of the fixed-point dew point and absolute
+ * @n humidity and of the same formulas with log()/exp() is printed once, then the derived metrics of a new
+ * @n measurement are printed every second.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+*/
+
+#include <DFRobot_SHT3x.h>
+#include <DFRobot_SHT3x_Psychrometrics.h>
+
+#define CALLS 1000
+
+DFRobot_SHT3x sht3x;
+
+volatile int32_t sink;
+volatile float sinkF;
+
+void printTime(const char *name, uint32_t us)
+{
+  Serial.print(name);
+  Serial.print(" us/call:");
+  Serial.print((float)us / CALLS);
+  Serial.print(" cycles/call:");
+  Serial.println((float)us / CALLS * (F_CPU / 1000000L));
+}
+
+void benchmark()
+{
+  uint32_t start;
+  uint16_t rawT, rawH;
+  float t, rh, gamma;
+
+  start = micros();
+  for(uint16_t i = 0; i < CALLS; i++){
+    sink = DFRobot_SHT3x_Psychrometrics::dewPoint(20000 + i * 16, 10000 + i * 40);
+  }
+  printTime("dewPoint fixed-point", micros() - start);
+
+  start = micros();
+  for(uint16_t i = 0; i < CALLS; i++){
+    sink = DFRobot_SHT3x_Psychrometrics::absoluteHumidity(20000 + i * 16, 10000 + i * 40);
+  }
+  printTime("absoluteHumidity fixed-point", micros() - start);
+
+  start = micros();
+  for(uint16_t i = 0; i < CALLS; i++){
+    rawT = 20000 + i * 16;
+    rawH = 10000 + i * 40;
+    t = 175.0f * rawT / 65535.0f - 45.0f;
+    rh = 100.0f * rawH / 65535.0f;
+    gamma = log(rh / 100.0f) + 17.62f * t / (243.12f + t);
+    sinkF = 243.12f * gamma / (17.62f - gamma);
+  }
+  printTime("dewPoint math.h", micros() - start);
+
+  start = micros();
+  for(uint16_t i = 0; i < CALLS; i++){
+    rawT = 20000 + i * 16;
+    rawH = 10000 + i * 40;
+    t = 175.0f * rawT / 65535.0f - 45.0f;
+    rh = 100.0f * rawH / 65535.0f;
+    sinkF = 216.7f * (rh / 100.0f * 6.112f * exp(17.62f * t / (243.12f + t))) / (273.15f + t);
+  }
+  printTime("absoluteHumidity math.h", micros() - start);
+
+  start = micros();
+  for(uint16_t i = 0; i < CALLS; i++){
+    sink = DFRobot_SHT3x_Psychrometrics::heatIndex(20000 + i * 16, 10000 + i * 40);
+  }
+  printTime("heatIndex", micros() - start);
+}
+
+void setup() {
+  Serial.begin(9600);
+  while (sht3x.begin() != 0) {
+    Serial.println("Failed to initialize the chip, please confirm the chip connection");
+    delay(1000);
+  }
+  benchmark();
+}
+
+void loop() {
+  if(sht3x.readTemperatureAndHumidity(sht3x.eRepeatability_High).ERR == 0){
+    uint16_t rawT = sht3x.getRawTemperature();
+    uint16_t rawH = sht3x.getRawHumidity();
+    Serial.print("Dew point:");
+    Serial.print(DFRobot_SHT3x_Psychrometrics::dewPoint(rawT, rawH) / 100.0f);
+    Serial.print(" C Absolute humidity:");
+    Serial.print(DFRobot_SHT3x_Psychrometrics::absoluteHumidity(rawT, rawH) / 100.0f);
+    Serial.print(" g/m3 Heat index:");
+    Serial.print(DFRobot_SHT3x_Psychrometrics::heatIndex(rawT, rawH) / 100.0f);
+    Serial.println(" C");
+  }
+  delay(1000);
+}
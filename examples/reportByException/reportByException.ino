@@ -0,0 +1,55 @@
+/*!
+ * @file reportByException.ino
+ * @brief Only print the temperature and humidity when they changed, or at least once a minute.
+ * @details Experimental phenomenon: the chip works in cycle measurement mode at 1Hz and a sample is read every second,
+ * @n but it is printed at the serial port only when the temperature moved by more than 0.2°C, the humidity by more
+ * @n than 1%RH, or when nothing was printed for 60 seconds (heartbeat). Breathe on the sensor to see a report.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+*/
+
+#include <DFRobot_SHT3x.h>
+
+DFRobot_SHT3x sht3x;
+
+/*!
+ * @brief Construct the filter
+ * @param maxSilenceMs Heartbeat, a sample is reported at least this often (ms), 0 disables the heartbeat.
+ */
+DFRobot_SHT3x_Deadband deadband(/*maxSilenceMs=*/60000);
+
+void setup() {
+
+  Serial.begin(9600);
+  while (sht3x.begin() != 0) {
+    Serial.println("Failed to initialize the chip, please confirm the chip connection");
+    delay(1000);
+  }
+  if(!sht3x.startPeriodicMode(sht3x.eMeasureFreq_1Hz)){
+    Serial.println("Failed to enter the periodic mode");
+  }
+  deadband.setTemperatureDeadbandC(0.2);
+  deadband.setHumidityDeadbandRH(1.0);
+  sht3x.attachDeadband(&deadband);
+}
+
+void loop() {
+  DFRobot_SHT3x::sRHAndTemp_t data;
+  /**
+   * readTemperatureAndHumidityOnChange Read one sample and report it only when it left the deadband or the heartbeat expired.
+   * @return Return true when the sample is reported.
+   */
+  if(sht3x.readTemperatureAndHumidityOnChange(data)){
+    Serial.print(millis() / 1000);
+    Serial.print("s ambient temperature(°C):");
+    Serial.print(data.TemperatureC);
+    Serial.print(" C relative humidity(%RH):");
+    Serial.print(data.Humidity);
+    Serial.println(" %RH");
+  }
+  delay(1000);
+}
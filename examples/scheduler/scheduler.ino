@@ -0,0 +1,56 @@
+/*!
+ * @file scheduler.ino
+ * @brief Let the driver choose between single and cycle measurement mode for a wanted sample interval.
+ * @details Experimental phenomenon: the estimated average current of both modes is printed for a few intervals, then
+ * @n the scheduler enters the cheaper mode for a 5 second interval and prints a sample every 5 seconds.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+*/
+
+#include <DFRobot_SHT3x.h>
+#include <DFRobot_SHT3x_Scheduler.h>
+
+DFRobot_SHT3x sht3x;
+DFRobot_SHT3x_Scheduler scheduler(sht3x);
+
+void setup() {
+  const uint32_t intervals[] = {100, 500, 1000, 2000, 5000, 60000};
+
+  Serial.begin(9600);
+  while (sht3x.begin() != 0) {
+    Serial.println("Failed to initialize the chip, please confirm the chip connection");
+    delay(1000);
+  }
+  /**
+   * setMcuCurrent Current drawn by the MCU while it blocks on the sensor (µA), adjust it to the board.
+   */
+  scheduler.setMcuCurrent(5000);
+  for(uint8_t i = 0; i < sizeof(intervals) / sizeof(intervals[0]); i++){
+    Serial.print("interval(ms):");
+    Serial.print(intervals[i]);
+    Serial.print(" single(uA):");
+    Serial.print(scheduler.estimateSingleCurrentUA(intervals[i], sht3x.eRepeatability_High));
+    Serial.print(" periodic(uA):");
+    Serial.println(scheduler.estimatePeriodicCurrentUA(intervals[i], sht3x.eRepeatability_High));
+  }
+  if(!scheduler.begin(/*intervalMs=*/5000, sht3x.eRepeatability_High)){
+    Serial.println("Failed to schedule the acquisition");
+  }
+  Serial.print(scheduler.isPeriodic() ? "cycle measurement mode" : "single measurement mode");
+  Serial.print(", estimated average current(uA):");
+  Serial.println(scheduler.getAverageCurrentUA());
+}
+
+void loop() {
+  DFRobot_SHT3x::sRHAndTemp_t data;
+  if(scheduler.update(data) && data.ERR == 0){
+    Serial.print("temperature(°C):");
+    Serial.print(data.TemperatureC);
+    Serial.print(" humidity(%RH):");
+    Serial.println(data.Humidity);
+  }
+}
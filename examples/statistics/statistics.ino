@@ -0,0 +1,67 @@
+/*!
+ * @file statistics.ino
+ * @brief Summarize the temperature and humidity samples with a streaming statistics accumulator.
+ * @details Experimental phenomenon: the chip works in cycle measurement mode at 1Hz, every sample read is fed into
+ * @n the accumulator by the driver itself, and every 10 samples the count, min/max, mean, variance and EWMA
+ * @n of both channels are printed at the serial port, then a new window is started.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+*/
+
+#include <DFRobot_SHT3x.h>
+
+DFRobot_SHT3x sht3x;
+
+/*!
+ * @brief Construct the accumulator
+ * @param ewmaShift EWMA smoothing factor, alpha = 1/2^ewmaShift.
+ */
+DFRobot_SHT3x_Stats stats(/*ewmaShift=*/3);
+
+void printChannel(const char *name, DFRobot_SHT3x_Stats::eChannel_t channel)
+{
+  Serial.print(name);
+  Serial.print(" min:");
+  Serial.print(stats.getMin(channel));
+  Serial.print(" max:");
+  Serial.print(stats.getMax(channel));
+  Serial.print(" mean:");
+  Serial.print(stats.getMean(channel));
+  Serial.print(" variance:");
+  Serial.print(stats.getVariance(channel), 4);
+  Serial.print(" ewma:");
+  Serial.println(stats.getEwma(channel));
+}
+
+void setup() {
+
+  Serial.begin(9600);
+  while (sht3x.begin() != 0) {
+    Serial.println("Failed to initialize the chip, please confirm the chip connection");
+    delay(1000);
+  }
+  if(!sht3x.startPeriodicMode(sht3x.eMeasureFreq_1Hz)){
+    Serial.println("Failed to enter the periodic mode");
+  }
+  /**
+   * attachStatistics Feed every successful read into the accumulator.
+   */
+  sht3x.attachStatistics(&stats);
+}
+
+void loop() {
+  sht3x.readTemperatureAndHumidity();
+  if(stats.getCount() >= 10){
+    Serial.print("samples:");
+    Serial.println(stats.getCount());
+    printChannel("temperature(C)", DFRobot_SHT3x_Stats::eTemperature);
+    printChannel("humidity(%RH)", DFRobot_SHT3x_Stats::eHumidity);
+    //Start a new window
+    stats.reset();
+  }
+  delay(1000);
+}
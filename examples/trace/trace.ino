@@ -0,0 +1,96 @@
+/*!
+ * @file trace.ino
+ * @brief Record the timeline of the driver operations inside environmentState() and setHumidityLimitRH().
+ * @details Experimental phenomenon: both calls are wrapped in a user span, then every logged event is printed with
+ * @n its time from the start of the span, indented by nesting depth, followed by the time the span spent in delays.
+ * @n The delays that pad the transfers show up as the largest part of each call.
+ * @n On a Linux host, DFRobot_SHT3x_Trace::exportChromeTrace("trace.json") writes the same events for
+ * @n chrome://tracing or https://ui.perfetto.dev instead.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+*/
+
+#include <DFRobot_SHT3x.h>
+
+#define TRACE_EVENTS 128
+
+DFRobot_SHT3x sht3x;
+
+DFRobot_SHT3x_Trace::sEvent_t events[TRACE_EVENTS];
+DFRobot_SHT3x_Trace trace(events, TRACE_EVENTS);
+
+const char *operationName[] = {"write", "read", "command", "delay", "user"};
+
+/**
+ * Print the events logged since the last clear, then clear the recorder
+ */
+void printTimeline()
+{
+  uint32_t start = trace.getEvent(0).timeUs;
+  uint32_t delayBegin = 0;
+  uint32_t delayUs = 0;
+  uint8_t depth = 0;
+  for(uint16_t i = 0; i < trace.getCount(); i++){
+    const DFRobot_SHT3x_Trace::sEvent_t &event = trace.getEvent(i);
+    if(event.phase == DFRobot_SHT3x_Trace::eTraceEnd && depth){
+      depth--;
+    }
+    Serial.print(event.timeUs - start);
+    Serial.print(" us\t");
+    for(uint8_t j = 0; j < depth; j++){
+      Serial.print("  ");
+    }
+    Serial.print(event.phase == DFRobot_SHT3x_Trace::eTraceBegin ? "> " : "< ");
+    Serial.print(operationName[event.operation]);
+    Serial.print(" ");
+    Serial.println(event.arg, (event.operation == DFRobot_SHT3x_Trace::eTraceWrite || event.operation == DFRobot_SHT3x_Trace::eTraceCommand) ? HEX : DEC);
+    if(event.phase == DFRobot_SHT3x_Trace::eTraceBegin){
+      depth++;
+    }
+    if(event.operation == DFRobot_SHT3x_Trace::eTraceDelay){
+      if(event.phase == DFRobot_SHT3x_Trace::eTraceBegin){
+        delayBegin = event.timeUs;
+      } else {
+        delayUs += event.timeUs - delayBegin;
+      }
+    }
+  }
+  Serial.print("total ");
+  Serial.print(trace.getEvent(trace.getCount() - 1).timeUs - start);
+  Serial.print(" us, in delays ");
+  Serial.print(delayUs);
+  Serial.print(" us, events dropped ");
+  Serial.println(trace.getDropped());
+  Serial.println();
+  trace.clear();
+}
+
+void setup() {
+  Serial.begin(9600);
+  while (sht3x.begin() != 0) {
+    Serial.println("Failed to Initialize the chip, please confirm the wire connection");
+    delay(1000);
+  }
+  sht3x.startPeriodicMode(sht3x.eMeasureFreq_1Hz);
+  delay(1000);
+  sht3x.attachTrace(&trace);
+
+  Serial.println("environmentState()");
+  trace.record(DFRobot_SHT3x_Trace::eTraceUser, DFRobot_SHT3x_Trace::eTraceBegin, 1);
+  sht3x.environmentState();
+  trace.record(DFRobot_SHT3x_Trace::eTraceUser, DFRobot_SHT3x_Trace::eTraceEnd, 1);
+  printTimeline();
+
+  Serial.println("setHumidityLimitRH()");
+  trace.record(DFRobot_SHT3x_Trace::eTraceUser, DFRobot_SHT3x_Trace::eTraceBegin, 2);
+  sht3x.setHumidityLimitRH(80, 78, 20, 22);
+  trace.record(DFRobot_SHT3x_Trace::eTraceUser, DFRobot_SHT3x_Trace::eTraceEnd, 2);
+  printTimeline();
+}
+
+void loop() {
+}
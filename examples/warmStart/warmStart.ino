@@ -0,0 +1,88 @@
+/*!
+ * @file warmStart.ino
+ * @brief Compare the time from begin() to the first valid sample for a cold start and a warm start.
+ * @details Experimental phenomenon: the usual cold start (begin, softReset, clearStatusRegister, startPeriodicMode,
+ * @n first fetch) and the warm start (begin with the cached serial number and configuration, first fetch) are timed
+ * @n a few times and the average of each is printed in microseconds.
+ * @n The warm start only restores the configuration when the chip was reset, which it reads from the reset flag:
+ * @n the flag must be clear when the snapshot is taken (begin() and startPeriodicMode() clear it, softReset() sets it).
+ * @n On a board that deep sleeps, keep serialNumber and snapshot in retained RAM (e.g. RTC_DATA_ATTR on ESP32)
+ * @n and only call the warm start begin() after waking up.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+*/
+
+#include <DFRobot_SHT3x.h>
+
+#define ROUNDS 5
+
+DFRobot_SHT3x sht3x;
+
+uint32_t serialNumber;
+DFRobot_SHT3x::sConfigSnapshot_t snapshot;
+
+/**
+ * Wait for the first valid sample of the cycle measurement mode, the chip answers NACK until it is ready
+ */
+void waitFirstSample()
+{
+  while(sht3x.readTemperatureAndHumidity().ERR != 0);
+}
+
+uint32_t coldStart()
+{
+  uint32_t start = micros();
+  if(sht3x.begin() != 0){
+    return 0;
+  }
+  sht3x.softReset();
+  sht3x.clearStatusRegister();
+  sht3x.startPeriodicMode(sht3x.eMeasureFreq_10Hz, sht3x.eRepeatability_High);
+  waitFirstSample();
+  return micros() - start;
+}
+
+uint32_t warmStart()
+{
+  uint32_t start = micros();
+  if(sht3x.begin(serialNumber, snapshot) != 0){
+    return 0;
+  }
+  waitFirstSample();
+  return micros() - start;
+}
+
+void setup() {
+  uint32_t cold = 0;
+  uint32_t warm = 0;
+
+  Serial.begin(9600);
+  while (sht3x.begin() != 0) {
+    Serial.println("Failed to initialize the chip, please confirm the chip connection");
+    delay(1000);
+  }
+  for(uint8_t i = 0; i < ROUNDS; i++){
+    cold += coldStart();
+    /**
+     * Keep what the warm start needs, then let the chip run alone like during the MCU deep sleep
+     */
+    serialNumber = sht3x.getSerialNumber();
+    snapshot = sht3x.getConfigSnapshot();
+    delay(500);
+    warm += warmStart();
+    sht3x.stopPeriodicMode();
+  }
+  Serial.print("serial number:");
+  Serial.println(serialNumber, HEX);
+  Serial.print("cold start to first sample(us):");
+  Serial.println(cold / ROUNDS);
+  Serial.print("warm start to first sample(us):");
+  Serial.println(warm / ROUNDS);
+}
+
+void loop() {
+}
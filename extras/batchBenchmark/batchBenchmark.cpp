@@ -0,0 +1,91 @@
+/*!
+ * @file batchBenchmark.cpp
+ * @brief Throughput of DFRobot_SHT3x_Batch::convertFrames for every kernel the CPU supports, on a Linux host.
+ * @details Random frames are generated, one in 64 with a wrong CRC, then each kernel converts them several times.
+ * @n Its results are compared with the scalar kernel bit for bit and its speed is printed in frames per second.
+ * @n Build from the library folder:
+ * @n   g++ -O2 -I. extras/batchBenchmark/batchBenchmark.cpp DFRobot_SHT3x_Batch.cpp -o batchBenchmark
+ * @n The NEON kernel is not delivered: on aarch64 add -DSHT3X_BATCH_ENABLE_NEON to build it and check it here first.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include <DFRobot_SHT3x_Batch.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+#define FRAMES    100000
+#define ROUNDS    50
+
+static uint8_t crc8(const uint8_t *data)
+{
+  uint8_t crc = 0xFF;
+  for(uint8_t i = 0; i < 2; i++){
+    crc ^= data[i];
+    for(uint8_t bit = 0; bit < 8; bit++){
+      crc = (crc & 0x80) ? (crc << 1) ^ 0x31 : (crc << 1);
+    }
+  }
+  return crc;
+}
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main()
+{
+  const char *names[4] = {"scalar","SSE2","AVX2","NEON"};
+  std::vector<uint8_t> frames(FRAMES * SHT3X_FRAME_SIZE);
+  std::vector<float> refT(FRAMES),refH(FRAMES),t(FRAMES),h(FRAMES);
+  std::vector<uint8_t> refValid(FRAMES),valid(FRAMES);
+  size_t refCount;
+
+  srand(1);
+  for(size_t i = 0; i < FRAMES; i++){
+    uint8_t *f = &frames[i * SHT3X_FRAME_SIZE];
+    f[0] = rand();
+    f[1] = rand();
+    f[2] = crc8(f);
+    f[3] = rand();
+    f[4] = rand();
+    f[5] = crc8(f + 3);
+    if(i % 64 == 63){
+      f[(i / 64) % 2 ? 2 : 5] ^= 0x01;
+    }
+  }
+  DFRobot_SHT3x_Batch::setKernel(DFRobot_SHT3x_Batch::eKernelScalar);
+  refCount = DFRobot_SHT3x_Batch::convertFrames(frames.data(),FRAMES,refT.data(),refH.data(),refValid.data());
+  printf("%u frames, %u pass the CRC check\n",FRAMES,(unsigned)refCount);
+
+  for(int k = DFRobot_SHT3x_Batch::eKernelScalar; k <= DFRobot_SHT3x_Batch::eKernelNEON; k++){
+    size_t count = 0;
+    double start;
+    bool same;
+    if(!DFRobot_SHT3x_Batch::setKernel((DFRobot_SHT3x_Batch::eKernel_t)k)){
+      printf("%-6s not supported\n",names[k]);
+      continue;
+    }
+    //One round first so that page faults and cold caches are not timed
+    DFRobot_SHT3x_Batch::convertFrames(frames.data(),FRAMES,t.data(),h.data(),valid.data());
+    start = now();
+    for(int r = 0; r < ROUNDS; r++){
+      count = DFRobot_SHT3x_Batch::convertFrames(frames.data(),FRAMES,t.data(),h.data(),valid.data());
+    }
+    double seconds = now() - start;
+    same = (count == refCount) && !memcmp(t.data(),refT.data(),FRAMES * sizeof(float))
+           && !memcmp(h.data(),refH.data(),FRAMES * sizeof(float)) && !memcmp(valid.data(),refValid.data(),FRAMES);
+    printf("%-6s %8.1f Mframes/s  %s\n",names[k],(double)FRAMES * ROUNDS / seconds / 1e6,same ? "same results as scalar" : "MISMATCH");
+  }
+  return 0;
+}
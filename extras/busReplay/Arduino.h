@@ -0,0 +1,48 @@
+/*!
+ * @file Arduino.h
+ * @brief The few Arduino functions the driver uses, for building it on a Linux host with busReplay.
+ * @details Time is the real monotonic clock, so that a replay with timing reproduces the recorded latencies.
+ * @n Pins do nothing: on the host the chip is the capture.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef BUSREPLAY_ARDUINO_H
+#define BUSREPLAY_ARDUINO_H
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+#define HIGH    1
+#define LOW     0
+#define INPUT   0
+#define OUTPUT  1
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+void pinMode(uint8_t pin,uint8_t mode);
+void digitalWrite(uint8_t pin,uint8_t value);
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+class Print
+{
+public:
+  virtual size_t write(uint8_t data) = 0;
+  virtual size_t write(const uint8_t *pBuf,size_t size)
+  {
+    for(size_t i = 0; i < size; i++){
+      write(pBuf[i]);
+    }
+    return size;
+  }
+};
+#endif
@@ -0,0 +1,28 @@
+/*!
+ * @file Wire.h
+ * @brief An empty TwoWire for building the driver on a Linux host with busReplay, the transfers go to the replay.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef BUSREPLAY_WIRE_H
+#define BUSREPLAY_WIRE_H
+#include "Arduino.h"
+
+class TwoWire
+{
+public:
+  void begin(){}
+  void beginTransmission(uint8_t address){ (void)address; }
+  size_t write(uint8_t data){ (void)data; return 1; }
+  uint8_t endTransmission(bool stop = true){ (void)stop; return 2; }
+  uint8_t requestFrom(uint8_t address,size_t size){ (void)address; (void)size; return 0; }
+  int read(){ return -1; }
+};
+
+extern TwoWire Wire;
+#endif
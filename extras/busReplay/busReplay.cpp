@@ -0,0 +1,144 @@
+/*!
+ * @file busReplay.cpp
+ * @brief Play a capture of examples/busCapture back into the driver on a Linux host.
+ * @details The driver runs the calls of the busCapture sketch (begin, 10Hz periodic mode, one read per loop) with
+ * @n the capture as its bus, so a field failure (NACKs, CRC errors, odd data) can be stepped through under a
+ * @n debugger. For each read the reading, the error and the time the call took are printed, then a summary:
+ * @n latency min/avg/max, read errors, NACKs and CRC errors seen in the capture, and the transfers where the driver
+ * @n did not follow the recorded sequence. --no-timing returns every transfer at once instead of taking its
+ * @n recorded bus time, --pace starts every transfer at its recorded time (otherwise the gaps between transfers are
+ * @n the delays of the driver on the host), --dump lists the records without running the driver.
+ * @n Build from the library folder:
+ * @n   g++ -O2 -Iextras/busReplay -I. extras/busReplay/busReplay.cpp extras/busReplay/hostArduino.cpp \
+ * @n     DFRobot_SHT3x.cpp DFRobot_SHT3x_Stats.cpp DFRobot_SHT3x_Deadband.cpp DFRobot_SHT3x_Trace.cpp \
+ * @n     DFRobot_SHT3x_Mux.cpp DFRobot_SHT3x_Replay.cpp -o busReplay
+ * @n   ./busReplay capture.bin
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include <DFRobot_SHT3x.h>
+#include <DFRobot_SHT3x_Replay.h>
+#include <stdio.h>
+#include <string.h>
+
+static uint8_t crc8(const uint8_t *data)
+{
+  uint8_t crc = 0xFF;
+  for(uint8_t i = 0; i < 2; i++){
+    crc ^= data[i];
+    for(uint8_t bit = 0; bit < 8; bit++){
+      crc = (crc & 0x80) ? (crc << 1) ^ 0x31 : (crc << 1);
+    }
+  }
+  return crc;
+}
+
+static void dump(DFRobot_SHT3x_Replay &replay)
+{
+  DFRobot_SHT3x_Replay::sRecord_t record;
+  while(replay.readRecord(record)){
+    printf("%10lu us %5lu us %-5s size %2u result %2u :",(unsigned long)record.timeUs,(unsigned long)record.durationUs,
+           record.read ? "read" : "write",record.size,record.result);
+    for(uint8_t i = 0; i < record.length; i++){
+      printf(" %02X",record.data[i]);
+    }
+    printf("\n");
+  }
+}
+
+static void countFaults(DFRobot_SHT3x_Replay &replay,uint32_t &nacks,uint32_t &crcErrors)
+{
+  DFRobot_SHT3x_Replay::sRecord_t record;
+  nacks = 0;
+  crcErrors = 0;
+  while(replay.readRecord(record)){
+    if(record.read ? record.result == 0 : record.result != 0){
+      nacks++;
+      continue;
+    }
+    //every 3-byte word of a read ends with its CRC
+    for(uint8_t i = 0; record.read && i + 3 <= record.length; i += 3){
+      if(crc8(record.data + i) != record.data[i + 2]){
+        crcErrors++;
+      }
+    }
+  }
+  replay.rewind();
+}
+
+int main(int argc,char **argv)
+{
+  const char *path = NULL;
+  bool timing = true;
+  bool pacing = false;
+  bool dumpOnly = false;
+  for(int i = 1; i < argc; i++){
+    if(strcmp(argv[i],"--no-timing") == 0){
+      timing = false;
+    } else if(strcmp(argv[i],"--pace") == 0){
+      pacing = true;
+    } else if(strcmp(argv[i],"--dump") == 0){
+      dumpOnly = true;
+    } else {
+      path = argv[i];
+    }
+  }
+  DFRobot_SHT3x_Replay replay;
+  if(path == NULL){
+    fprintf(stderr,"usage: %s [--no-timing] [--pace] [--dump] capture.bin\n",argv[0]);
+    return 2;
+  }
+  if(!replay.open(path)){
+    fprintf(stderr,"%s: not a readable capture\n",path);
+    return 1;
+  }
+  printf("%s: chip 0x%02X, %lu transfers\n",path,replay.getAddress(),(unsigned long)replay.getRecordCount());
+  if(dumpOnly){
+    dump(replay);
+    return 0;
+  }
+  uint32_t nacks,crcErrors;
+  countFaults(replay,nacks,crcErrors);
+  replay.setTiming(timing);
+  replay.setPacing(pacing);
+
+  DFRobot_SHT3x sht3x(&Wire,replay.getAddress());
+  sht3x.setTransport(&replay);
+  uint32_t attempts = 0;
+  while(!replay.isFinished() && sht3x.begin() != 0){
+    attempts++;
+  }
+  printf("begin: %lu failed attempts, serial number 0x%08lX\n",(unsigned long)attempts,(unsigned long)sht3x.getSerialNumber());
+  sht3x.startPeriodicMode(sht3x.eMeasureFreq_10Hz);
+
+  uint32_t reads = 0,errors = 0;
+  unsigned long minUs = 0xFFFFFFFF,maxUs = 0,sumUs = 0;
+  while(!replay.isFinished()){
+    unsigned long start = micros();
+    DFRobot_SHT3x::sRHAndTemp_t data = sht3x.readTemperatureAndHumidity();
+    unsigned long us = micros() - start;
+    reads++;
+    sumUs += us;
+    minUs = us < minUs ? us : minUs;
+    maxUs = us > maxUs ? us : maxUs;
+    if(data.ERR != 0){
+      errors++;
+      printf("%5lu: error %d, %lu us\n",(unsigned long)reads,data.ERR,us);
+    } else {
+      printf("%5lu: %6.2f C %6.2f %%RH, %lu us\n",(unsigned long)reads,data.TemperatureC,data.Humidity,us);
+    }
+  }
+  if(reads == 0){
+    minUs = 0;
+  }
+  printf("reads %lu, errors %lu, latency min %lu avg %lu max %lu us\n",(unsigned long)reads,(unsigned long)errors,
+         minUs,reads ? sumUs / reads : 0,maxUs);
+  printf("capture: %lu NACKs, %lu CRC errors; %lu transfers did not match the capture\n",(unsigned long)nacks,
+         (unsigned long)crcErrors,(unsigned long)replay.getMismatchCount());
+  return replay.getMismatchCount() ? 3 : 0;
+}
@@ -0,0 +1,66 @@
+/*!
+ * @file hostArduino.cpp
+ * @brief Implementation of the Arduino functions of busReplay on the Linux monotonic clock
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include "Arduino.h"
+#include "Wire.h"
+#include <time.h>
+
+TwoWire Wire;
+
+static uint64_t nowUs()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static const uint64_t startUs = nowUs();
+
+void pinMode(uint8_t pin,uint8_t mode)
+{
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(uint8_t pin,uint8_t value)
+{
+  (void)pin;
+  (void)value;
+}
+
+unsigned long millis()
+{
+  return (nowUs() - startUs) / 1000;
+}
+
+unsigned long micros()
+{
+  return nowUs() - startUs;
+}
+
+void delay(unsigned long ms)
+{
+  delayMicroseconds(ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  //sleep most of the time and spin the end, nanosleep alone overshoots by tens of microseconds
+  uint64_t end = nowUs() + us;
+  if(us > 200){
+    struct timespec ts;
+    uint64_t sleepUs = us - 100;
+    ts.tv_sec = sleepUs / 1000000;
+    ts.tv_nsec = (sleepUs % 1000000) * 1000;
+    nanosleep(&ts,NULL);
+  }
+  while(nowUs() < end);
+}
@@ -0,0 +1,48 @@
+/*!
+ * @file Arduino.h
+ * @brief The few Arduino functions the driver uses, for building it on a Linux host against the simulated chip of hostMock.
+ * @details Time is simulated: it only moves in delay() and delayMicroseconds(), so the cases run in no time and
+ * @n always take the same path. Pins do nothing.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef HOSTMOCK_ARDUINO_H
+#define HOSTMOCK_ARDUINO_H
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+#define HIGH    1
+#define LOW     0
+#define INPUT   0
+#define OUTPUT  1
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+void pinMode(uint8_t pin,uint8_t mode);
+void digitalWrite(uint8_t pin,uint8_t value);
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+class Print
+{
+public:
+  virtual size_t write(uint8_t data) = 0;
+  virtual size_t write(const uint8_t *pBuf,size_t size)
+  {
+    for(size_t i = 0; i < size; i++){
+      write(pBuf[i]);
+    }
+    return size;
+  }
+};
+#endif
@@ -0,0 +1,28 @@
+/*!
+ * @file Wire.h
+ * @brief A TwoWire for building the driver on a Linux host, the transfers go to the simulated chip of hostMock.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef HOSTMOCK_WIRE_H
+#define HOSTMOCK_WIRE_H
+#include "Arduino.h"
+
+class TwoWire
+{
+public:
+  void begin(){}
+  void beginTransmission(uint8_t address);
+  size_t write(uint8_t data);
+  uint8_t endTransmission(bool stop = true);
+  uint8_t requestFrom(uint8_t address,size_t size);
+  int read();
+};
+
+extern TwoWire Wire;
+#endif
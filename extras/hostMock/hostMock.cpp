@@ -0,0 +1,247 @@
+/*!
+ * @file hostMock.cpp
+ * @brief Implementation of the simulated clock, SHT3x and I2C multiplexer of hostMock
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include "hostMock.h"
+#include "Wire.h"
+
+#define SIM_MUX_ADDRESS       0x70
+#define SIM_FIRST_SAMPLE_US   10000
+
+TwoWire Wire;
+sSimChip_t simChip;
+
+static uint64_t nowUs = 0;
+static uint8_t address;
+static uint8_t tx[8];
+static uint8_t txCount;
+static uint8_t rx[6];
+static uint8_t rxCount;
+static uint8_t rxIndex;
+static uint64_t cycleStartUs;
+static int32_t lastFetched;
+static uint16_t limits[4];
+
+void pinMode(uint8_t pin,uint8_t mode)
+{
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(uint8_t pin,uint8_t value)
+{
+  (void)pin;
+  (void)value;
+}
+
+unsigned long millis()
+{
+  return nowUs / 1000;
+}
+
+unsigned long micros()
+{
+  return nowUs;
+}
+
+void delay(unsigned long ms)
+{
+  nowUs += (uint64_t)ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  nowUs += us;
+}
+
+static uint8_t crc8(uint16_t word)
+{
+  uint8_t crc = 0xFF;
+  uint8_t data[2] = {(uint8_t)(word >> 8),(uint8_t)word};
+  for(uint8_t i = 0; i < 2; i++){
+    crc ^= data[i];
+    for(uint8_t bit = 0; bit < 8; bit++){
+      crc = (crc & 0x80) ? (crc << 1) ^ 0x31 : (crc << 1);
+    }
+  }
+  return crc;
+}
+
+static void answer(uint16_t word)
+{
+  if(rxCount + 3 <= (int)sizeof(rx)){
+    rx[rxCount++] = word >> 8;
+    rx[rxCount++] = word;
+    rx[rxCount++] = crc8(word);
+  }
+}
+
+static void answerSample()
+{
+  answer(simChip.rawT);
+  answer(simChip.rawH);
+}
+
+/**
+ * @fn limitIndex
+ * @brief Index of the alert limit of a read (0xE1xx) or write (0x61xx) command, -1 when it is none.
+ */
+static int limitIndex(uint8_t lsb)
+{
+  switch(lsb){
+    case 0x1F: case 0x1D: return 0;
+    case 0x14: case 0x16: return 1;
+    case 0x09: case 0x0B: return 2;
+    case 0x02: case 0x00: return 3;
+  }
+  return -1;
+}
+
+static uint32_t cyclePeriodUs(uint8_t msb)
+{
+  switch(msb){
+    case 0x20: return 2000000;
+    case 0x21: return 1000000;
+    case 0x22: return 500000;
+    case 0x23: return 250000;
+    case 0x27: return 100000;
+    case 0x2B: return 250000;
+  }
+  return 0;
+}
+
+static void command(uint16_t cmd)
+{
+  uint8_t msb = cmd >> 8;
+  if(simChip.logCount < SIM_LOG_SIZE){
+    simChip.log[simChip.logCount++] = cmd;
+  }
+  rxCount = 0;
+  rxIndex = 0;
+  if(cmd == 0xE000){
+    if(simChip.periodUs && nowUs >= cycleStartUs + SIM_FIRST_SAMPLE_US){
+      int32_t sample = (nowUs - cycleStartUs - SIM_FIRST_SAMPLE_US) / simChip.periodUs;
+      if(sample > lastFetched){
+        lastFetched = sample;
+        answerSample();
+      }
+    }
+  } else if(msb == 0x24 || msb == 0x2C){
+    answerSample();
+  } else if(cyclePeriodUs(msb)){
+    simChip.periodUs = cyclePeriodUs(msb);
+    cycleStartUs = nowUs;
+    lastFetched = -1;
+  } else if(cmd == 0x3093){
+    simChip.periodUs = 0;
+  } else if(cmd == 0x30A2){
+    simPowerUp();
+  } else if(cmd == 0xF32D){
+    answer(simChip.status);
+  } else if(cmd == 0x3041){
+    simChip.status &= ~0x8C10;
+  } else if(cmd == 0x306D){
+    simChip.status |= 0x2000;
+  } else if(cmd == 0x3066){
+    simChip.status &= ~0x2000;
+  } else if(cmd == 0x3780){
+    answer(0x1234);
+    answer(0x5678);
+  } else if(msb == 0xE1 && limitIndex(cmd) >= 0){
+    answer(limits[limitIndex(cmd)]);
+  } else if(msb == 0x61 && limitIndex(cmd) >= 0 && txCount == 5){
+    limits[limitIndex(cmd)] = (tx[2] << 8) | tx[3];
+  }
+}
+
+static bool chipReachable()
+{
+  if(address != 0x44 && address != 0x45){
+    return false;
+  }
+  return simChip.muxWrites == 0 || (simChip.muxChannels & simChip.chipChannels);
+}
+
+void simPowerUp()
+{
+  simChip.status = 0x8010;
+  simChip.periodUs = 0;
+  memset(limits,0,sizeof(limits));
+  rxCount = 0;
+  rxIndex = 0;
+}
+
+void simClearLog()
+{
+  simChip.logCount = 0;
+}
+
+bool simLogged(const uint16_t *pCmds,uint8_t count)
+{
+  if(simChip.logCount != count){
+    return false;
+  }
+  return memcmp(simChip.log,pCmds,count * sizeof(uint16_t)) == 0;
+}
+
+void TwoWire::beginTransmission(uint8_t addr)
+{
+  address = addr;
+  txCount = 0;
+}
+
+size_t TwoWire::write(uint8_t data)
+{
+  if(txCount < sizeof(tx)){
+    tx[txCount++] = data;
+  }
+  return 1;
+}
+
+uint8_t TwoWire::endTransmission(bool stop)
+{
+  (void)stop;
+  if(address == SIM_MUX_ADDRESS){
+    if(simChip.muxNack){
+      return 2;
+    }
+    simChip.muxChannels = txCount ? tx[0] : 0;
+    simChip.muxWrites++;
+    return 0;
+  }
+  if(!chipReachable()){
+    return 2;
+  }
+  if(txCount >= 2){
+    command((tx[0] << 8) | tx[1]);
+  }
+  return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t addr,size_t size)
+{
+  address = addr;
+  if(!chipReachable() || simChip.nack || rxIndex >= rxCount){
+    rxCount = 0;
+    rxIndex = 0;
+    return 0;
+  }
+  //the chip sends what it has left of its answer, the rest reads 0xFF
+  uint8_t len = (size_t)(rxCount - rxIndex) < size ? rxCount - rxIndex : size;
+  return len;
+}
+
+int TwoWire::read()
+{
+  if(rxIndex < rxCount){
+    return rx[rxIndex++];
+  }
+  return 0xFF;
+}
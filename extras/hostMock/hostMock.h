@@ -0,0 +1,60 @@
+/*!
+ * @file hostMock.h
+ * @brief The simulated SHT3x and I2C multiplexer behind the TwoWire of hostMock
+ * @details The chip answers at 0x44 and 0x45 on an open multiplexer channel (or always when the multiplexer was
+ * @n never written), the multiplexer at 0x70. It keeps a status register, the heater bit, the alert limits, and in
+ * @n cycle measurement mode one new sample per period: a fetch with no new sample, or a read while nothing is
+ * @n pending, is NACKed like on the real chip. The first sample comes 10ms after the start of the cycle.
+ * @n simChip is all zero until the case sets it up.
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#ifndef HOSTMOCK_H
+#define HOSTMOCK_H
+#include "Arduino.h"
+
+#define SIM_LOG_SIZE   64   ///< Commands kept in the log of the chip
+
+typedef struct {
+  uint16_t status;/**<Status register, the power-up value has the reset flag (0x0010) set*/
+  uint16_t rawT;/**<Raw temperature word of the samples*/
+  uint16_t rawH;/**<Raw humidity word of the samples*/
+  uint32_t periodUs;/**<Measurement period of the running cycle, 0 in single measurement mode*/
+  bool nack;/**<NACK every read of the chip, e.g. a broken wire*/
+  bool muxNack;/**<NACK every write to the multiplexer*/
+  uint8_t muxChannels;/**<Channel mask last written to the multiplexer*/
+  uint8_t chipChannels;/**<Multiplexer channels the chip answers on (bit mask), a sensor per channel shares the chip state*/
+  uint32_t muxWrites;/**<Writes to the multiplexer*/
+  uint16_t log[SIM_LOG_SIZE];/**<Commands received by the chip, oldest first*/
+  uint8_t logCount;/**<Commands in the log, it stops growing when full*/
+} sSimChip_t;
+
+extern sSimChip_t simChip;
+
+/**
+ * @fn simPowerUp
+ * @brief Put the chip in its power-up state (reset flag set, single measurement mode), like the soft reset command.
+ * @n The multiplexer and the simulated clock are left as they are.
+ */
+void simPowerUp();
+
+/**
+ * @fn simClearLog
+ * @brief Empty the command log.
+ */
+void simClearLog();
+
+/**
+ * @fn simLogged
+ * @brief Compare the command log with a list.
+ * @param pCmds  Expected commands, oldest first
+ * @param count  Number of expected commands
+ * @return Return true when the log holds exactly these commands
+ */
+bool simLogged(const uint16_t *pCmds,uint8_t count);
+#endif
@@ -0,0 +1,238 @@
+/*!
+ * @file mockCases.cpp
+ * @brief Run the driver against the simulated chip of hostMock and check the bus behaviour of the fixes that
+ * @n cannot be seen on a board without a scope, the name of each case says the request it covers.
+ * @details Prints a line per check and returns the number of failed checks.
+ * @n Build from the library folder:
+ * @n   g++ -O2 -Iextras/hostMock -I. extras/hostMock/mockCases.cpp extras/hostMock/hostMock.cpp \
+ * @n     DFRobot_SHT3x.cpp DFRobot_SHT3x_Stats.cpp DFRobot_SHT3x_Deadband.cpp DFRobot_SHT3x_Trace.cpp \
+ * @n     DFRobot_SHT3x_Mux.cpp DFRobot_SHT3x_AdaptiveRate.cpp -o mockCases
+ * @n   ./mockCases
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include "hostMock.h"
+#include "DFRobot_SHT3x.h"
+#include "DFRobot_SHT3x_AdaptiveRate.h"
+#include <stdio.h>
+
+#define RAW_PER_C   374   ///< Raw temperature counts per °C
+
+static int failures = 0;
+
+static void check(const char *name,bool ok)
+{
+  printf("%s %s\n",ok ? "ok  " : "FAIL",name);
+  if(!ok){
+    failures++;
+  }
+}
+
+/**
+ * @fn setUp
+ * @brief A chip just powered, on multiplexer channel 0, reading 25 °C and 50 %RH.
+ */
+static void setUp()
+{
+  memset(&simChip,0,sizeof(simChip));
+  simChip.rawT = 0x6666;
+  simChip.rawH = 0x8000;
+  simChip.chipChannels = 0x01;
+  simPowerUp();
+}
+
+/**
+ * @fn logged
+ * @brief Number of times the chip received a command since the log was cleared.
+ */
+static uint8_t logged(uint16_t cmd)
+{
+  uint8_t count = 0;
+  for(uint8_t i = 0; i < simChip.logCount; i++){
+    if(simChip.log[i] == cmd){
+      count++;
+    }
+  }
+  return count;
+}
+
+/**
+ * @fn fetchFor
+ * @brief Fetch every intervalMs for durationMs in cycle measurement mode.
+ * @return Return the number of samples received
+ */
+static uint16_t fetchFor(DFRobot_SHT3x &sht3x,uint32_t durationMs,uint32_t intervalMs)
+{
+  uint16_t samples = 0;
+  for(uint32_t elapsed = 0; elapsed < durationMs; elapsed += intervalMs){
+    delay(intervalMs);
+    if(sht3x.readTemperatureAndHumidity().ERR == 0){
+      samples++;
+    }
+  }
+  return samples;
+}
+
+/**
+ * @fn noise
+ * @brief Uniform noise of +-25 counts (about 0.04 °C rms), the same sequence on every run.
+ */
+static int noise()
+{
+  static uint32_t seed = 1;
+  seed = seed * 1103515245 + 12345;
+  return (int)((seed >> 16) % 51) - 25;
+}
+
+/**
+ * @fn adaptiveRun
+ * @brief Fetch at the period of the controller for a while, the temperature moving by slope counts per second.
+ * @return Return the shortest period used
+ */
+static uint16_t adaptiveRun(DFRobot_SHT3x_AdaptiveRate &adaptive,float &base,uint32_t durationMs,float slope)
+{
+  uint16_t shortest = 0xFFFF;
+  for(uint32_t elapsed = 0; elapsed < durationMs;){
+    uint16_t period = adaptive.getPeriodMs();
+    delay(period);
+    elapsed += period;
+    base += slope * period / 1000;
+    simChip.rawT = (uint16_t)base + noise();
+    simChip.rawH = 0x8000 + noise();
+    adaptive.readTemperatureAndHumidity();
+    if(adaptive.getPeriodMs() < shortest){
+      shortest = adaptive.getPeriodMs();
+    }
+  }
+  return shortest;
+}
+
+/**
+ * @fn caseUser030
+ * @brief The averaged rate of change: the noise alone never reaches the release threshold at 10 Hz, so after a
+ * @n ramp the controller steps back to the lowest frequency.
+ */
+static void caseUser030()
+{
+  setUp();
+  DFRobot_SHT3x sht3x;
+  DFRobot_SHT3x_AdaptiveRate adaptive(sht3x);
+  float base = 0x6666;
+  sht3x.begin();
+  adaptive.begin();
+  check("user-030 noise alone stays at 0.5 Hz",adaptiveRun(adaptive,base,60000,0) == 2000);
+  check("user-030 a 1 C/s ramp goes to 10 Hz",adaptiveRun(adaptive,base,4000,RAW_PER_C) == 100);
+  adaptiveRun(adaptive,base,60000,0);
+  check("user-030 back to 0.5 Hz after the ramp",adaptive.getPeriodMs() == 2000);
+}
+
+/**
+ * @fn caseUser034
+ * @brief Auto-restore only restores after a real reset: not for the power-up flag, not for the NACKs of early
+ * @n fetches, not for a status it could not read, and a real reset (flag set, no samples) is restored.
+ */
+static void caseUser034()
+{
+  setUp();
+  DFRobot_SHT3x sht3x;
+  sht3x.begin();
+  check("user-034 the cold begin clears the power-up reset flag",(simChip.status & 0x0010) == 0);
+  sht3x.heaterEnable();
+  sht3x.startPeriodicMode(sht3x.eMeasureFreq_10Hz);
+  sht3x.setAutoRestore(true);
+  simClearLog();
+  uint16_t samples = fetchFor(sht3x,1000,30);
+  check("user-034 early fetch NACKs read no status",samples >= 9 && logged(0xF32D) == 0);
+
+  simPowerUp();
+  simClearLog();
+  fetchFor(sht3x,300,30);
+  check("user-034 a real reset is restored once",logged(0xF32D) == 1 && logged(0x3041) == 1 && logged(0x306D) == 1 && logged(0x2737) == 1);
+  check("user-034 the restore brings back the heater and the cycle",(simChip.status & 0x2010) == 0x2000 && simChip.periodUs == 100000);
+  check("user-034 samples come again after the restore",fetchFor(sht3x,300,100) >= 2);
+
+  setUp();
+  DFRobot_SHT3x single;
+  single.begin();
+  single.heaterEnable();
+  single.setAutoRestore(true);
+  simChip.nack = true;
+  simClearLog();
+  single.readTemperatureAndHumidity(single.eRepeatability_High);
+  check("user-034 an unreadable status is not taken for a reset",logged(0xF32D) > 0 && logged(0x3041) == 0);
+}
+
+/**
+ * @fn caseUser035
+ * @brief The warm begin() after a deep sleep: one status read when the chip kept its state, the configuration
+ * @n restored when the chip was reset in the meantime.
+ */
+static void caseUser035()
+{
+  setUp();
+  DFRobot_SHT3x cold;
+  cold.begin();
+  cold.startPeriodicMode(cold.eMeasureFreq_10Hz);
+  uint32_t serialNumber = cold.getSerialNumber();
+  DFRobot_SHT3x::sConfigSnapshot_t snapshot = cold.getConfigSnapshot();
+
+  const uint16_t kept[] = {0xF32D};
+  DFRobot_SHT3x warm;
+  simClearLog();
+  check("user-035 the warm begin succeeds",warm.begin(serialNumber,snapshot) == 0);
+  check("user-035 a chip that kept its state only gets the status read",simLogged(kept,1));
+  check("user-035 samples come from the running cycle",fetchFor(warm,300,100) >= 2);
+
+  const uint16_t reset[] = {0xF32D,0x3041,0x2737};
+  DFRobot_SHT3x restored;
+  simPowerUp();
+  simClearLog();
+  restored.begin(serialNumber,snapshot);
+  check("user-035 a reset chip gets the configuration again",simLogged(reset,3));
+  check("user-035 samples come after the restore",fetchFor(restored,300,100) >= 2);
+}
+
+/**
+ * @fn caseUser044
+ * @brief Sensors behind a multiplexer: a transfer whose channel cannot be selected is not sent, the NACKs of the
+ * @n sensor do not rewrite the multiplexer, a reset check does.
+ */
+static void caseUser044()
+{
+  setUp();
+  simChip.chipChannels = 0x03;
+  DFRobot_SHT3x_Mux mux;
+  DFRobot_SHT3x outOfRange(&mux,8);
+  DFRobot_SHT3x first(&mux,0);
+  DFRobot_SHT3x second(&mux,1);
+  check("user-044 a sensor on an out-of-range channel fails begin()",outOfRange.begin() == ERR_DATA_BUS);
+  check("user-044 a sensor on a valid channel begins",first.begin() == 0 && second.begin() == 0);
+
+  first.startPeriodicMode(first.eMeasureFreq_10Hz);
+  first.setAutoRestore(true);
+  uint32_t writes = simChip.muxWrites;
+  fetchFor(first,250,5);
+  check("user-044 fetch NACKs do not rewrite the multiplexer",simChip.muxWrites == writes);
+  first.checkReset();
+  check("user-044 a reset check writes the multiplexer again",simChip.muxWrites == writes + 1);
+
+  simChip.muxNack = true;
+  simClearLog();
+  check("user-044 a sensor whose channel cannot be selected fails",second.readTemperatureAndHumidity(second.eRepeatability_High).ERR != 0);
+  check("user-044 its command is not sent on the open channel",simChip.logCount == 0);
+}
+
+int main()
+{
+  caseUser030();
+  caseUser034();
+  caseUser035();
+  caseUser044();
+  printf("%d failed\n",failures);
+  return failures;
+}
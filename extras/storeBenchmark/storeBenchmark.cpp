@@ -0,0 +1,125 @@
+/*!
+ * @file storeBenchmark.cpp
+ * @brief Append and scan speed of DFRobot_SHT3x_Store on a Linux host, against a CSV log of the same samples.
+ * @details Samples of 8 sensors, one every 10ms each, are appended to a store committed once at the end (the cost
+ * @n of the append alone), then to a store committed every 256 appends and one with the default commit interval,
+ * @n then written as CSV lines with fprintf, the way the gateways logged them before, without and with a flush to
+ * @n the disk as often as the store commits by default.
+ * @n Then the whole store is scanned for one sensor, a one-minute range is found and scanned, and the raw words are
+ * @n converted while scanning.
+ * @n Run it on the disk the gateway writes to: the commit time is the disk flush time.
+ * @n Build from the library folder:
+ * @n   g++ -O2 -I. extras/storeBenchmark/storeBenchmark.cpp DFRobot_SHT3x_Store.cpp -o storeBenchmark
+ * @n   ./storeBenchmark [directory]
+ * @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+ * @License     The MIT License (MIT)
+ * @author [fengli](li.feng@dfrobot.com)
+ * @version  V1.0
+ * @date  2026-10-18
+ * @url https://github.com/DFRobot/DFRobot_SHT3x
+ */
+
+#include <DFRobot_SHT3x_Store.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SAMPLES   4000000
+#define SENSORS   8
+#define START_MS  1790000000000ULL
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+typedef struct{
+  double temperatureC;
+  double humidity;
+} sSum_t;
+
+static void addRecord(const DFRobot_SHT3x_Store::sRecord_t *record,void *context)
+{
+  sSum_t *sum = (sSum_t *)context;
+  sum->temperatureC += 175.0f * record->rawTemperature / 65535.0f - 45.0f;
+  sum->humidity += 100.0f * record->rawHumidity / 65535.0f;
+}
+
+int main(int argc,char **argv)
+{
+  const char *directory = argc > 1 ? argv[1] : ".";
+  char storePath[512],csvPath[512];
+  snprintf(storePath,sizeof(storePath),"%s/storeBenchmark.s3xs",directory);
+  snprintf(csvPath,sizeof(csvPath),"%s/storeBenchmark.csv",directory);
+  double start,seconds;
+  DFRobot_SHT3x_Store store;
+  const uint32_t intervals[3] = {SAMPLES,256,SHT3X_STORE_COMMIT_INTERVAL};
+  for(uint8_t run = 0; run < 3; run++){
+    unlink(storePath);
+    if(!store.open(storePath,SAMPLES,intervals[run])){
+      fprintf(stderr,"%s: cannot create the store\n",storePath);
+      return 1;
+    }
+    start = now();
+    for(uint32_t i = 0; i < SAMPLES; i++){
+      store.append(START_MS + (i / SENSORS) * 10,0x1000 + i % SENSORS,0x6000 + (i & 0xFF),0x8000 - (i & 0x7F));
+    }
+    store.commit();
+    seconds = now() - start;
+    printf("store, commit every %7u: %.1f ns per sample\n",intervals[run],seconds * 1e9 / SAMPLES);
+    store.close();
+  }
+
+  for(uint8_t run = 0; run < 2; run++){
+    FILE *fp = fopen(csvPath,"w");
+    if(fp == NULL){
+      break;
+    }
+    start = now();
+    for(uint32_t i = 0; i < SAMPLES; i++){
+      fprintf(fp,"%llu,%08X,%.2f,%.2f\n",(unsigned long long)(START_MS + (i / SENSORS) * 10),0x1000 + i % SENSORS,
+              175.0f * (0x6000 + (i & 0xFF)) / 65535.0f - 45.0f,100.0f * (0x8000 - (i & 0x7F)) / 65535.0f);
+      if(run == 1 && (i + 1) % SHT3X_STORE_COMMIT_INTERVAL == 0){
+        fflush(fp);
+        fdatasync(fileno(fp));
+      }
+    }
+    fflush(fp);
+    fdatasync(fileno(fp));
+    fclose(fp);
+    seconds = now() - start;
+    printf("CSV, %-20s: %.1f ns per sample\n",run ? "flush as the store" : "flush at the end",seconds * 1e9 / SAMPLES);
+    unlink(csvPath);
+  }
+
+  //a second instance, as a reader process would
+  DFRobot_SHT3x_Store reader;
+  if(!reader.openReadOnly(storePath)){
+    fprintf(stderr,"%s: cannot open the store\n",storePath);
+    return 1;
+  }
+  sSum_t sum = {0,0};
+  start = now();
+  size_t found = reader.scan(0x1003,0,~0ULL,addRecord,&sum);
+  seconds = now() - start;
+  printf("scan one sensor: %lu of %llu records in %.3f s, %.2f ns per record scanned, mean %.2f C %.2f %%RH\n",
+         (unsigned long)found,(unsigned long long)(reader.getEnd() - reader.getFirst()),seconds,
+         seconds * 1e9 / (reader.getEnd() - reader.getFirst()),sum.temperatureC / found,sum.humidity / found);
+
+  uint64_t fromMs = START_MS + 2000000;
+  start = now();
+  uint64_t position = reader.lowerBound(fromMs);
+  double lookup = now() - start;
+  sum.temperatureC = sum.humidity = 0;
+  start = now();
+  found = reader.scan(0,fromMs,fromMs + 60000,addRecord,&sum);
+  seconds = now() - start;
+  printf("one-minute range: position %llu found in %.2f us, %lu records scanned in %.1f us\n",(unsigned long long)position,
+         lookup * 1e6,(unsigned long)found,seconds * 1e6);
+  reader.close();
+  unlink(storePath);
+  return 0;
+}
@@ -13,7 +13,7 @@
 '''
 
 import sys
-import smbus
+from smbus2 import SMBus, i2c_msg
 import logging
 import numpy as np
 from ctypes import *
@@ -69,6 +69,13 @@ SHT3X_CMD_WRITE_HIGH_ALERT_LIMIT_CLEAR   = 0x6116
 SHT3X_CMD_WRITE_LOW_ALERT_LIMIT_CLEAR    = 0x610B
 SHT3X_CMD_WRITE_LOW_ALERT_LIMIT_SET      = 0x6100
 
+SHT3X_CONVERSION_TIME_H                  = 0.0155 # Max single measurement time, high repeatability (s)
+SHT3X_CONVERSION_TIME_M                  = 0.0065 # Max single measurement time, medium repeatability (s)
+SHT3X_CONVERSION_TIME_L                  = 0.0045 # Max single measurement time, low repeatability (s)
+SHT3X_FETCH_POLL_INTERVAL                = 0.001  # Retry interval while the periodic result is not ready (s)
+SHT3X_FETCH_GUARD                        = 0.002  # Wake up this much before the next periodic result is expected (s)
+SHT3X_COMMAND_GAP                        = 0.001  # Gap between a command and its read, as the Arduino driver keeps (s)
+
 TEMP_RH_TEMP_C = 0
 TEMP_RH_HUM    = 1
 TEMP_RH_TEMP_F  = 2
@@ -97,13 +104,16 @@ class DFRobot_SHT3x:
   measureFreq_2Hz = 2
   measureFreq_4Hz = 3
   measureFreq_10Hz = 4
+  _measure_period = [2.0,1.0,0.5,0.25,0.1]
 
   def __init__(self, iic_addr = 0x45,bus = 1):
-    self.i2cbus=smbus.SMBus(bus)
+    self.i2cbus=SMBus(bus)
     self.i2c_addr = iic_addr
+    self.bus = bus
     self.tempRH= [0,0,0,0]
     self.limit_Data = [0,0,0,0]
     self._measure_freq = 0
+    self._next_sample = 0
 
 
   def begin(self,RST = 4):
@@ -126,9 +136,7 @@ class DFRobot_SHT3x:
       @return 32-digit serial number
     '''
     result = 0
-    self.__write_reg(SHT3X_CMD_READ_SERIAL_NUMBER>>8,SHT3X_CMD_READ_SERIAL_NUMBER&0xFF)
-    time.sleep(0.001)
-    data0 = self.__read_reg(6)
+    data0 = self.__read_command(SHT3X_CMD_READ_SERIAL_NUMBER,6,0.001)
     data1= [data0[0],data0[1],data0[2]]
     data2= [data0[3],data0[4],data0[5]]
     if((self.__check_crc(data1) == data0[2]) and (self.__check_crc(data2) == data0[5])):
@@ -231,7 +239,6 @@ class DFRobot_SHT3x:
        @brief Read the state of the pin ALERT.
        @return High returns 1, low returns 0.
     '''
-    time.sleep(0.001)
     register_raw = self.__read_status_register()
     if(((register_raw & 0x0800) == 1)or((register_raw & 0x0400) == 1)):
       return True
@@ -247,34 +254,50 @@ class DFRobot_SHT3x:
       @n                    repeatability_medium = 1  #/**<In medium repeatability mode, the humidity repeatability is 0.15%RH, the temperature repeatability is 0.12°C*/
       @n                    repeatability_low = 2     #/**<In low repeatability mode, the humidity repeatability is0.25%RH, the temperature repeatability is 0.24°C*/
       @n                    repeatability_periodic = 3  Periodic reading of data
+      @n In single measurement mode only the max conversion time of the repeatability is waited. In cycle measurement
+      @n mode the call returns as soon as the sensor has a result newer than the last one read.
       @return Return a list containing celsius temperature (°C), Fahrenheit temperature (°F), relative humidity (%RH), status code
       @n A status of 0 indicates the right return data.
     '''
     self.tempRH[TEMP_RH_ERR] = 0
     if (repeatability == self.repeatability_high):
-      self.__write_reg(SHT3X_CMD_GETDATA_H>>8,SHT3X_CMD_GETDATA_H&0xFF)
-      time.sleep(0.015)
+      data0 = self.__read_command(SHT3X_CMD_GETDATA_H,6,SHT3X_CONVERSION_TIME_H)
     elif(repeatability == self.repeatability_medium):
-      self.__write_reg(SHT3X_CMD_GETDATA_M>>8,SHT3X_CMD_GETDATA_M&0xFF)
-      time.sleep(0.015)
+      data0 = self.__read_command(SHT3X_CMD_GETDATA_M,6,SHT3X_CONVERSION_TIME_M)
     elif(repeatability == self.repeatability_low):
-      self.__write_reg(SHT3X_CMD_GETDATA_L>>8,SHT3X_CMD_GETDATA_L&0xFF)
-      time.sleep(0.015)
-    elif(repeatability == self.repeatability_periodic):
-      self.__write_reg(SHT3X_CMD_GETDATA>>8,SHT3X_CMD_GETDATA&0xFF)
-      time.sleep(0.015)
-    data0 = self.__read_reg(6)
-    data1= [data0[0],data0[1],data0[2]]
-    data2= [data0[3],data0[4],data0[5]]
-    if((self.__check_crc(data1) != data0[2]) or (self.__check_crc(data2) != data0[5])):
+      data0 = self.__read_command(SHT3X_CMD_GETDATA_L,6,SHT3X_CONVERSION_TIME_L)
+    else:
+      data0 = self.__fetch_periodic()
+      if(data0 is None):
+        self.tempRH[TEMP_RH_ERR] = -1
+        return self.tempRH
+    result = self.parse_raw_data(data0)
+    if(result[TEMP_RH_ERR] != 0):
       self.tempRH[TEMP_RH_ERR] = -1
       return self.tempRH
-    self.tempRH[TEMP_RH_TEMP_C] = self.__convert_temperature(data1)
-    self.tempRH[TEMP_RH_TEMP_F] = (9.0/5)*self.tempRH[TEMP_RH_TEMP_C] + 32
-    self.tempRH[TEMP_RH_HUM] = self.__convert_humidity(data2)
+    self.tempRH[:] = result
     return self.tempRH
 
 
+  def parse_raw_data(self,data):
+    '''!
+      @brief Check the CRC of a raw measurement result and convert it, used by the readers that do the bus transfers themselves.
+      @param data  6 bytes read from the sensor: temperature msb, lsb, crc, humidity msb, lsb, crc
+      @return Return a new list indexed by TEMP_RH_TEMP_C, TEMP_RH_HUM, TEMP_RH_TEMP_F and TEMP_RH_ERR
+      @n A status of 0 indicates the right return data, -1 a CRC error.
+    '''
+    result = [0,0,0,0]
+    data1= [data[0],data[1],data[2]]
+    data2= [data[3],data[4],data[5]]
+    if((self.__check_crc(data1) != data[2]) or (self.__check_crc(data2) != data[5])):
+      result[TEMP_RH_ERR] = -1
+      return result
+    result[TEMP_RH_TEMP_C] = self.__convert_temperature(data1)
+    result[TEMP_RH_TEMP_F] = (9.0/5)*result[TEMP_RH_TEMP_C] + 32
+    result[TEMP_RH_HUM] = self.__convert_humidity(data2)
+    return result
+
+
   def get_temperature_C(self):
     '''!
        @brief Get the measured temperature (in degrees Celsius)
@@ -336,6 +359,7 @@ class DFRobot_SHT3x:
     self.measurement_mode = self.Periodic
     self._measure_freq = measure_freq
     self.__write_reg(cmd[measure_freq][repeatability]>>8,cmd[measure_freq][repeatability]&0xFF)
+    self._next_sample = time.monotonic() + SHT3X_CONVERSION_TIME_H
     time.sleep(0.001)
     register_raw = self.__read_status_register()
     if((register_raw & 0x02) == 0):
@@ -349,9 +373,7 @@ class DFRobot_SHT3x:
        @return Return to status like whether heater is ON or OFF, the status of the pin alert, reset status and the former cmd is executed or not.
     '''
     for i in range(0,10):
-      self.__write_reg(SHT3X_CMD_READ_STATUS_REG>>8,SHT3X_CMD_READ_STATUS_REG&0xFF)
-      time.sleep(0.001)
-      register1 = self.__read_reg(3)
+      register1 = self.__read_command(SHT3X_CMD_READ_STATUS_REG,3)
       if(self.__check_crc(register1) == register1[2]):
         break
     data = (register1[0]<<8) | register1[1]
@@ -419,9 +441,7 @@ class DFRobot_SHT3x:
     if((high_set > high_clear) and (high_clear > low_clear) and (low_clear > low_set)):
       
       _high_set = self.__convert_raw_temperature(high_set)
-      self.__write_reg(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_SET>>8,SHT3X_CMD_READ_HIGH_ALERT_LIMIT_SET&0xFF)
-      time.sleep(0.001)
-      buf = self.__read_reg(3)
+      buf = self.__read_command(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_SET,3)
       if(self.__check_crc(buf)!= buf[2]):
         return 1
       limit = buf[0]
@@ -430,9 +450,7 @@ class DFRobot_SHT3x:
       self.__write_limit_data(SHT3X_CMD_WRITE_HIGH_ALERT_LIMIT_SET,_high_set)
       
       _high_clear= self.__convert_raw_temperature(high_clear)
-      self.__write_reg(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_CLEAR>>8,SHT3X_CMD_READ_HIGH_ALERT_LIMIT_CLEAR&0xFF)
-      time.sleep(0.001)
-      buf = self.__read_reg(3)
+      buf = self.__read_command(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_CLEAR,3)
       if(self.__check_crc(buf)!= buf[2]):
         return 1
       limit = buf[0]
@@ -441,9 +459,7 @@ class DFRobot_SHT3x:
       self.__write_limit_data(SHT3X_CMD_WRITE_HIGH_ALERT_LIMIT_CLEAR,_high_clear)
       
       _low_clear= self.__convert_raw_temperature(low_clear)
-      self.__write_reg(SHT3X_CMD_READ_LOW_ALERT_LIMIT_CLEAR>>8,SHT3X_CMD_READ_LOW_ALERT_LIMIT_CLEAR&0xFF)
-      time.sleep(0.001)
-      buf = self.__read_reg(3)
+      buf = self.__read_command(SHT3X_CMD_READ_LOW_ALERT_LIMIT_CLEAR,3)
       if(self.__check_crc(buf)!= buf[2]):
         return 1
       limit = buf[0]
@@ -452,9 +468,7 @@ class DFRobot_SHT3x:
       self.__write_limit_data(SHT3X_CMD_WRITE_LOW_ALERT_LIMIT_CLEAR,_low_clear)
 
       _low_set= self.__convert_raw_temperature(low_set)
-      self.__write_reg(SHT3X_CMD_READ_LOW_ALERT_LIMIT_SET>>8,SHT3X_CMD_READ_LOW_ALERT_LIMIT_SET&0xFF)
-      time.sleep(0.001)
-      buf = self.__read_reg(3)
+      buf = self.__read_command(SHT3X_CMD_READ_LOW_ALERT_LIMIT_SET,3)
       if(self.__check_crc(buf)!= buf[2]):
         return 1
       limit = buf[0]
@@ -500,9 +514,7 @@ class DFRobot_SHT3x:
     if((high_set > high_clear) and (high_clear > low_clear) and (low_clear > low_set)):
       
       _high_set = self.__convert_raw_humidity(high_set)
-      self.__write_reg(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_SET>>8,SHT3X_CMD_READ_HIGH_ALERT_LIMIT_SET&0xFF)
-      time.sleep(0.001)
-      buf = self.__read_reg(3)
+      buf = self.__read_command(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_SET,3)
       if(self.__check_crc(buf)!= buf[2]):
         return 1
       limit = buf[0]
@@ -511,9 +523,7 @@ class DFRobot_SHT3x:
       self.__write_limit_data(SHT3X_CMD_WRITE_HIGH_ALERT_LIMIT_SET,_high_set)
       
       _high_clear= self.__convert_raw_humidity(high_clear)
-      self.__write_reg(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_CLEAR>>8,SHT3X_CMD_READ_HIGH_ALERT_LIMIT_CLEAR&0xFF)
-      time.sleep(0.001)
-      buf = self.__read_reg(3)
+      buf = self.__read_command(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_CLEAR,3)
       if(self.__check_crc(buf)!= buf[2]):
         return 1
       limit = buf[0]
@@ -522,9 +532,7 @@ class DFRobot_SHT3x:
       self.__write_limit_data(SHT3X_CMD_WRITE_HIGH_ALERT_LIMIT_CLEAR,_high_clear)
       
       _low_clear= self.__convert_raw_humidity(low_clear)
-      self.__write_reg(SHT3X_CMD_READ_LOW_ALERT_LIMIT_CLEAR>>8,SHT3X_CMD_READ_LOW_ALERT_LIMIT_CLEAR&0xFF)
-      time.sleep(0.001)
-      buf = self.__read_reg(3)
+      buf = self.__read_command(SHT3X_CMD_READ_LOW_ALERT_LIMIT_CLEAR,3)
       if(self.__check_crc(buf)!= buf[2]):
         return 1
       limit = buf[0]
@@ -533,9 +541,7 @@ class DFRobot_SHT3x:
       self.__write_limit_data(SHT3X_CMD_WRITE_LOW_ALERT_LIMIT_CLEAR,_low_clear)
 
       _low_set= self.__convert_raw_humidity(low_set)
-      self.__write_reg(SHT3X_CMD_READ_LOW_ALERT_LIMIT_SET>>8,SHT3X_CMD_READ_LOW_ALERT_LIMIT_SET&0xFF)
-      time.sleep(0.001)
-      buf = self.__read_reg(3)
+      buf = self.__read_command(SHT3X_CMD_READ_LOW_ALERT_LIMIT_SET,3)
       if(self.__check_crc(buf)!= buf[2]):
         return 1
       limit = buf[0]
@@ -553,9 +559,7 @@ class DFRobot_SHT3x:
        @return Return true indicates successful data acquisition
     '''
     limit = 0
-    self.__write_reg(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_SET>>8,SHT3X_CMD_READ_HIGH_ALERT_LIMIT_SET&0xFF)
-    time.sleep(0.001)
-    buf = self.__read_reg(3)
+    buf = self.__read_command(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_SET,3)
     if(self.__check_crc(buf)!= buf[2]):
       return False
     limit = buf[0]
@@ -563,9 +567,7 @@ class DFRobot_SHT3x:
     data = self.__convert_temp_limit_data(limit)
     self.limit_Data[HIGH_SET] = round(data,2)
 
-    self.__write_reg(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_CLEAR>>8,SHT3X_CMD_READ_HIGH_ALERT_LIMIT_CLEAR&0xFF)
-    time.sleep(0.001)
-    buf = self.__read_reg(3)
+    buf = self.__read_command(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_CLEAR,3)
     if(self.__check_crc(buf)!= buf[2]):
       return False
     limit = buf[0]
@@ -573,9 +575,7 @@ class DFRobot_SHT3x:
     data = self.__convert_temp_limit_data(limit)
     self.limit_Data[HIGH_CLEAR] = round(data,2)
 
-    self.__write_reg(SHT3X_CMD_READ_LOW_ALERT_LIMIT_CLEAR>>8,SHT3X_CMD_READ_LOW_ALERT_LIMIT_CLEAR&0xFF)
-    time.sleep(0.001)
-    buf = self.__read_reg(3)
+    buf = self.__read_command(SHT3X_CMD_READ_LOW_ALERT_LIMIT_CLEAR,3)
     if(self.__check_crc(buf)!= buf[2]):
       return False
     limit = buf[0]
@@ -583,9 +583,7 @@ class DFRobot_SHT3x:
     data = self.__convert_temp_limit_data(limit)
     self.limit_Data[LOW_CLEAR] = round(data,2)
 
-    self.__write_reg(SHT3X_CMD_READ_LOW_ALERT_LIMIT_SET>>8,SHT3X_CMD_READ_LOW_ALERT_LIMIT_SET&0xFF)
-    time.sleep(0.001)
-    buf = self.__read_reg(3)
+    buf = self.__read_command(SHT3X_CMD_READ_LOW_ALERT_LIMIT_SET,3)
     if(self.__check_crc(buf)!= buf[2]):
       return False
     limit = buf[0]
@@ -601,9 +599,7 @@ class DFRobot_SHT3x:
        @return Return true indicates successful data acquisition
     '''
     limit = 0
-    self.__write_reg(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_SET>>8,SHT3X_CMD_READ_HIGH_ALERT_LIMIT_SET&0xFF)
-    time.sleep(0.001)
-    buf = self.__read_reg(3)
+    buf = self.__read_command(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_SET,3)
     if(self.__check_crc(buf)!= buf[2]):
       return False
     limit = buf[0]
@@ -611,9 +607,7 @@ class DFRobot_SHT3x:
     data = self.__convert_temp_limit_data(limit)
     self.limit_Data[HIGH_SET] = round((data * 9 / 5.0 + 32),2)
 
-    self.__write_reg(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_CLEAR>>8,SHT3X_CMD_READ_HIGH_ALERT_LIMIT_CLEAR&0xFF)
-    time.sleep(0.001)
-    buf = self.__read_reg(3)
+    buf = self.__read_command(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_CLEAR,3)
     if(self.__check_crc(buf)!= buf[2]):
       return False
     limit = buf[0]
@@ -621,9 +615,7 @@ class DFRobot_SHT3x:
     data = self.__convert_temp_limit_data(limit)
     self.limit_Data[HIGH_CLEAR] = round(d(data * 9 / 5.0 + 32),2)
 
-    self.__write_reg(SHT3X_CMD_READ_LOW_ALERT_LIMIT_CLEAR>>8,SHT3X_CMD_READ_LOW_ALERT_LIMIT_CLEAR&0xFF)
-    time.sleep(0.001)
-    buf = self.__read_reg(3)
+    buf = self.__read_command(SHT3X_CMD_READ_LOW_ALERT_LIMIT_CLEAR,3)
     if(self.__check_crc(buf)!= buf[2]):
       return False
     limit = buf[0]
@@ -631,9 +623,7 @@ class DFRobot_SHT3x:
     data = self.__convert_temp_limit_data(limit)
     self.limit_Data[LOW_CLEAR] = round((data * 9 / 5.0 + 32),2)
 
-    self.__write_reg(SHT3X_CMD_READ_LOW_ALERT_LIMIT_SET>>8,SHT3X_CMD_READ_LOW_ALERT_LIMIT_SET&0xFF)
-    time.sleep(0.001)
-    buf = self.__read_reg(3)
+    buf = self.__read_command(SHT3X_CMD_READ_LOW_ALERT_LIMIT_SET,3)
     if(self.__check_crc(buf)!= buf[2]):
       return False
     limit = buf[0]
@@ -649,36 +639,28 @@ class DFRobot_SHT3x:
        @return Return true indicates successful data acquisition
     '''
     limit = 0
-    self.__write_reg(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_SET>>8,SHT3X_CMD_READ_HIGH_ALERT_LIMIT_SET&0xFF)
-    time.sleep(0.001)
-    buf = self.__read_reg(3)
+    buf = self.__read_command(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_SET,3)
     if(self.__check_crc(buf)!= buf[2]):
       return False
     limit = buf[0]
     limit = limit<< 8 | buf[1]
     self.limit_Data[HIGH_SET] = self.__convert_humidity_limit_data(limit)
 
-    self.__write_reg(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_CLEAR>>8,SHT3X_CMD_READ_HIGH_ALERT_LIMIT_CLEAR&0xFF)
-    time.sleep(0.001)
-    buf = self.__read_reg(3)
+    buf = self.__read_command(SHT3X_CMD_READ_HIGH_ALERT_LIMIT_CLEAR,3)
     if(self.__check_crc(buf)!= buf[2]):
       return False
     limit = buf[0]
     limit = limit<< 8 | buf[1]
     self.limit_Data[HIGH_CLEAR] = self.__convert_humidity_limit_data(limit)
 
-    self.__write_reg(SHT3X_CMD_READ_LOW_ALERT_LIMIT_CLEAR>>8,SHT3X_CMD_READ_LOW_ALERT_LIMIT_CLEAR&0xFF)
-    time.sleep(0.001)
-    buf = self.__read_reg(3)
+    buf = self.__read_command(SHT3X_CMD_READ_LOW_ALERT_LIMIT_CLEAR,3)
     if(self.__check_crc(buf)!= buf[2]):
       return False
     limit = buf[0]
     limit = limit<< 8 | buf[1]
     self.limit_Data[LOW_CLEAR] = self.__convert_humidity_limit_data(limit)
 
-    self.__write_reg(SHT3X_CMD_READ_LOW_ALERT_LIMIT_SET>>8,SHT3X_CMD_READ_LOW_ALERT_LIMIT_SET&0xFF)
-    time.sleep(0.001)
-    buf = self.__read_reg(3)
+    buf = self.__read_command(SHT3X_CMD_READ_LOW_ALERT_LIMIT_SET,3)
     if(self.__check_crc(buf)!= buf[2]):
       return False
     limit = buf[0]
@@ -892,21 +874,51 @@ class DFRobot_SHT3x:
 
   def __read_reg(self, len):
     '''!
-      @brief   从寄存器中读取数据
-      @param reg 寄存器地址
+      @brief   从传感器读取数据，不先发送寄存器地址
+      @param len 读取的字节数
       @return 读取的数据，list格式
     '''
-    rslt = self.i2cbus.read_i2c_block_data(self.i2c_addr,0x00,len)
-    if(self.measurement_mode == self.Periodic):
-      if(self._measure_freq == self.measureFreq_0_5Hz):
-        time.sleep(2)
-      elif(self._measure_freq == self.measureFreq_1Hz):
-        time.sleep(1)
-      elif(self._measure_freq == self.measureFreq_2Hz):
-        time.sleep(0.5)
-      elif(self._measure_freq == self.measureFreq_4Hz):
-        time.sleep(0.25)
-      elif(self._measure_freq == self.measureFreq_10Hz):
-        time.sleep(0.1)
-    return rslt
+    msg = i2c_msg.read(self.i2c_addr,len)
+    self.i2cbus.i2c_rdwr(msg)
+    return list(msg)
+
+
+  def __read_command(self, cmd, len, wait = SHT3X_COMMAND_GAP):
+    '''!
+      @brief   Send a command and read its response
+      @param cmd 16-bit command
+      @param len Number of bytes to read
+      @param wait Time the sensor needs between the command and the read (s), at least SHT3X_COMMAND_GAP
+      @return The data read, list
+    '''
+    write = i2c_msg.write(self.i2c_addr,[cmd >> 8,cmd & 0xFF])
+    self.i2cbus.i2c_rdwr(write)
+    time.sleep(max(wait,SHT3X_COMMAND_GAP))
+    return self.__read_reg(len)
+
+
+  def __fetch_periodic(self):
+    '''!
+      @brief   Fetch the result of the cycle measurement mode
+      @n The sensor NACKs the fetch while it has no new result, so sleep until the next result is expected,
+      @n then retry every SHT3X_FETCH_POLL_INTERVAL. The result time is known from the first fetch that succeeds after
+      @n a NACK; a fetch that succeeds straight away got a result that is at most one period old, so the next one
+      @n is expected within one period as well.
+      @return 6 bytes of raw data, None when no result came within one measurement period
+    '''
+    period = self._measure_period[self._measure_freq]
+    wait = self._next_sample - SHT3X_FETCH_GUARD - time.monotonic()
+    if(wait > 0):
+      time.sleep(wait)
+    deadline = time.monotonic() + period
+    while True:
+      try:
+        data = self.__read_command(SHT3X_CMD_GETDATA,6)
+        break
+      except OSError:
+        if(time.monotonic() > deadline):
+          return None
+        time.sleep(SHT3X_FETCH_POLL_INTERVAL)
+    self._next_sample = time.monotonic() + period
+    return data
 
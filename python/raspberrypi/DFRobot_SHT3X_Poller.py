@@ -0,0 +1,149 @@
+# -*- coding:utf-8 -*-
+'''!
+   @file DFRobot_SHT3X_Poller.py
+   @brief Define the infrastructure of the DFRobot_SHT3x_Poller class
+   @n asyncio acquisition layer for gateways polling many SHT3x sensors over several I2C buses. Every sweep
+   @n triggers a single shot on all sensors, awaits the conversion of all of them at once and reads them back,
+   @n so a sweep costs one conversion time instead of one per sensor. Transfers of a bus run on a worker thread
+   @n of their own, which serializes the access to each bus while different buses transfer at the same time.
+   @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+   @License     The MIT License (MIT)
+   @author      [fengli]<li.feng@dfrobot.com>
+   version  V1.0
+   date  2026-10-18
+   @url https://github.com/DFRobot/DFRobot_SHT3x
+'''
+
+import time
+import asyncio
+from collections import namedtuple
+from concurrent.futures import ThreadPoolExecutor
+from smbus2 import i2c_msg
+from DFRobot_SHT3X import *
+
+Sample = namedtuple('Sample',['name','timestamp','temperature_C','humidity_RH','err'])
+
+class DFRobot_SHT3x_Poller:
+
+  _single_shot = [(SHT3X_CMD_GETDATA_H,SHT3X_CONVERSION_TIME_H),\
+                  (SHT3X_CMD_GETDATA_M,SHT3X_CONVERSION_TIME_M),\
+                  (SHT3X_CMD_GETDATA_L,SHT3X_CONVERSION_TIME_L)]
+
+  def __init__(self,queue = None,maxsize = 0):
+    '''!
+      @brief Construct the function, call it from a coroutine so that the queue belongs to the running loop.
+      @param queue  asyncio.Queue the samples are published to, a new one of maxsize is created in default
+      @param maxsize  Size of the created queue, 0 for unbounded. A full queue holds the sweep back until it is read.
+    '''
+    self.queue = queue if queue is not None else asyncio.Queue(maxsize)
+    self._buses = {}
+    self._executors = {}
+
+
+  def add_sensor(self,sensor,name = None):
+    '''!
+      @brief Add a sensor to the sweep, the sensors are grouped by their bus number.
+      @param sensor  DFRobot_SHT3x object, begin() need not be called
+      @param name  Name of the samples of the sensor, "<bus>-0x<address>" in default
+    '''
+    if(sensor.bus not in self._buses):
+      self._buses[sensor.bus] = []
+      self._executors[sensor.bus] = ThreadPoolExecutor(max_workers = 1)
+    if(name is None):
+      name = "%s-0x%02x"%(sensor.bus,sensor.i2c_addr)
+    self._buses[sensor.bus].append((name,sensor))
+
+
+  async def sweep(self,repeatability = DFRobot_SHT3x.repeatability_high):
+    '''!
+      @brief Measure every sensor once and publish the samples to the queue.
+      @param repeatability  repeatability_high, repeatability_medium or repeatability_low
+      @return Return the list of Sample(name, timestamp, temperature_C, humidity_RH, err), err is 0 for a right sample,
+      @n -1 when the bus transfer or the CRC check failed.
+    '''
+    results = await asyncio.gather(*[self.__sweep_bus(bus,repeatability) for bus in self._buses])
+    return [sample for samples in results for sample in samples]
+
+
+  async def run(self,interval,repeatability = DFRobot_SHT3x.repeatability_high,count = None):
+    '''!
+      @brief Sweep at a fixed interval, a sweep that overruns the interval starts the next one at once.
+      @param interval  Time between the start of two sweeps (s)
+      @param repeatability  repeatability_high, repeatability_medium or repeatability_low
+      @param count  Number of sweeps, None to run until cancelled
+    '''
+    loop = asyncio.get_running_loop()
+    start = loop.time()
+    n = 0
+    while((count is None) or (n < count)):
+      await self.sweep(repeatability)
+      n += 1
+      start += interval
+      await asyncio.sleep(max(0,start - loop.time()))
+
+
+  def close(self):
+    '''!
+      @brief Stop the worker threads of the buses.
+    '''
+    for executor in self._executors.values():
+      executor.shutdown()
+    self._executors.clear()
+    self._buses.clear()
+
+
+  async def __sweep_bus(self,bus,repeatability):
+    '''!
+      @brief Trigger every sensor of one bus, await the conversion and read them back.
+      @return Return the samples of the bus
+    '''
+    loop = asyncio.get_running_loop()
+    executor = self._executors[bus]
+    sensors = self._buses[bus]
+    cmd,conversion = self._single_shot[repeatability]
+    triggered = await loop.run_in_executor(executor,self.__trigger,sensors,cmd)
+    wait = triggered + conversion - time.monotonic()
+    if(wait > 0):
+      await asyncio.sleep(wait)
+    raws = await loop.run_in_executor(executor,self.__read,sensors)
+    samples = []
+    timestamp = time.time()
+    for (name,sensor),raw in zip(sensors,raws):
+      if(raw is None):
+        result = [0,0,0,DFRobot_SHT3x.ERR_DATA_BUS]
+      else:
+        result = sensor.parse_raw_data(raw)
+      sample = Sample(name,timestamp,result[TEMP_RH_TEMP_C],result[TEMP_RH_HUM],result[TEMP_RH_ERR])
+      samples.append(sample)
+      await self.queue.put(sample)
+    return samples
+
+
+  def __trigger(self,sensors,cmd):
+    '''!
+      @brief Send the single shot command to every sensor of a bus, runs on the worker thread of the bus.
+      @return Return the monotonic time of the last command
+    '''
+    for name,sensor in sensors:
+      try:
+        sensor.i2cbus.i2c_rdwr(i2c_msg.write(sensor.i2c_addr,[cmd >> 8,cmd & 0xFF]))
+      except OSError:
+        pass
+    return time.monotonic()
+
+
+  def __read(self,sensors):
+    '''!
+      @brief Read the result of every sensor of a bus, runs on the worker thread of the bus.
+      @return Return a list of 6-byte results, None for the sensors that did not answer
+    '''
+    raws = []
+    for name,sensor in sensors:
+      msg = i2c_msg.read(sensor.i2c_addr,6)
+      try:
+        sensor.i2cbus.i2c_rdwr(msg)
+        raws.append(list(msg))
+      except OSError:
+        raws.append(None)
+    return raws
+
@@ -0,0 +1,100 @@
+# -*- coding:utf-8 -*-
+'''!
+   @file poller_benchmark.py
+   @brief Compare the throughput of the asyncio poller with reading the sensors one after another.
+   @n Experimental phenomenon: no sensor is needed, every bus is a fake one that answers like an SHT3x: a transfer
+   @n takes the time of its bytes at 100 kHz, a single shot result NACKs until 15.5 ms after the command.
+   @n The samples/s of the sequential read_temperature_and_humidity() loop and of DFRobot_SHT3x_Poller.sweep()
+   @n are printed for 4 buses of 8 sensors each.
+   @copyright  Copyright (c) 2010 DFRobot Co.Ltd (http://www.dfrobot.com)
+   @License     The MIT License (MIT)
+   @author      [fengli]<li.feng@dfrobot.com>
+   @version  V1.0
+   @date  2026-10-18
+   @url https://github.com/DFRobot/DFRobot_SHT3x
+'''
+
+import sys
+sys.path.append("../") # set system path to top
+import time
+import asyncio
+from DFRobot_SHT3X import *
+from DFRobot_SHT3X_Poller import *
+
+BUSES = 4
+SENSORS_PER_BUS = 8
+SWEEPS = 20
+I2C_FREQ = 100000
+
+class FakeBus:
+  '''!
+    @brief Stand-in for smbus2.SMBus, only i2c_rdwr is used by the driver in single measurement mode.
+  '''
+  def __init__(self):
+    self._ready = {}
+
+  def i2c_rdwr(self,*msgs):
+    for msg in msgs:
+      time.sleep((1 + msg.len) * 9.0 / I2C_FREQ)
+      if(msg.flags & 0x01):
+        if(time.monotonic() < self._ready.get(msg.addr,float('inf'))):
+          raise OSError(121,"Remote I/O error")
+        del self._ready[msg.addr]
+        raw = [0x66,0x66,0x93,0x80,0x00,0xA2]
+        for i in range(msg.len):
+          msg.buf[i] = raw[i]
+      else:
+        self._ready[msg.addr] = time.monotonic() + SHT3X_CONVERSION_TIME_H
+
+class FakeSensor(DFRobot_SHT3x):
+  '''!
+    @brief DFRobot_SHT3x on a fake bus instead of /dev/i2c-<bus>.
+  '''
+  def __init__(self,iic_addr,bus,fake_bus):
+    self.i2cbus = fake_bus
+    self.i2c_addr = iic_addr
+    self.bus = bus
+    self.tempRH = [0,0,0,0]
+    self.limit_Data = [0,0,0,0]
+    self._measure_freq = 0
+    self._next_sample = 0
+    self.measurement_mode = self.One_Shot
+
+def make_sensors():
+  sensors = []
+  for bus in range(BUSES):
+    fake_bus = FakeBus()
+    for i in range(SENSORS_PER_BUS):
+      sensors.append(FakeSensor(0x40 + i,bus,fake_bus))
+  return sensors
+
+def sequential(sensors):
+  start = time.monotonic()
+  for n in range(SWEEPS):
+    for sensor in sensors:
+      if(sensor.read_temperature_and_humidity(sensor.repeatability_high)[TEMP_RH_ERR] != 0):
+        print("sequential read failed")
+  return len(sensors) * SWEEPS / (time.monotonic() - start)
+
+async def concurrent(sensors):
+  poller = DFRobot_SHT3x_Poller()
+  for sensor in sensors:
+    poller.add_sensor(sensor)
+  errors = 0
+  start = time.monotonic()
+  for n in range(SWEEPS):
+    await poller.sweep(DFRobot_SHT3x.repeatability_high)
+    while not poller.queue.empty():
+      if(poller.queue.get_nowait().err != 0):
+        errors += 1
+  rate = len(sensors) * SWEEPS / (time.monotonic() - start)
+  poller.close()
+  if(errors):
+    print("%d poller samples failed"%errors)
+  return rate
+
+if __name__ == "__main__":
+  sensors = make_sensors()
+  print("%d buses x %d sensors, %d sweeps"%(BUSES,SENSORS_PER_BUS,SWEEPS))
+  print("sequential : %8.1f samples/s"%sequential(sensors))
+  print("asyncio    : %8.1f samples/s"%asyncio.run(concurrent(sensors)))